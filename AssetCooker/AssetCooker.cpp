@@ -0,0 +1,261 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Cooks the source models and textures of a project into its import cache, using every
+// core and no graphics device, so that a build server can do the work instead of each
+// machine that loads the project. Sources that didn't change since they were last cooked
+// are skipped, the runtime picks the cooked assets up through the same cache.
+//
+// A cooked model holds the meshes, materials and hierarchy of the import. The runtime still
+// creates the GameObjects, the .model and the .mat files from it, as they belong to a scene.
+// Shader variations are compiled by the runtime, the shader compiler only exists on Windows.
+//
+// Usage: AssetCooker <project directory> [-j threads] [-nomips] [-pack archive [-compress]]
+// Run it from the engine's directory and pass the project directory relative to it,
+// the cache is keyed by the same paths the runtime loads the assets with.
+//
+// With -pack, the project and its cooked artefacts are then packed into an archive under
+// those same paths. An archive next to the executable gets mounted when the engine starts.
+
+//= INCLUDES ==========================================
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../Runtime/FileSystem/FileSystem.h"
+#include "../Runtime/FileSystem/AssetArchive.h"
+#include "../Runtime/Logging/Log.h"
+#include "../Runtime/Logging/ILogger.h"
+#include "../Runtime/Resource/Import/ImportCache.h"
+#include "../Runtime/Resource/Import/TextureCooker.h"
+#include "../Runtime/Resource/Import/ModelCooker.h"
+//=====================================================
+
+//= NAMESPACES ==========
+using namespace std;
+using namespace Directus;
+//=======================
+
+struct CookResult
+{
+	string filePath;
+	bool isModel;
+	bool success;
+	bool upToDate;
+	double ms;
+};
+
+// Prints the engine's log to the console, from whichever thread writes to it
+class ConsoleLogger : public ILogger
+{
+public:
+	void Log(const string& log, int type) override
+	{
+		lock_guard<mutex> lock(m_mutex);
+		fprintf(type == Directus::Log::Info ? stdout : stderr, "%s\n", log.c_str());
+	}
+
+private:
+	mutex m_mutex;
+};
+
+// Collects the supported models and images of a directory and its subdirectories
+static void GetSourceAssets(const string& directory, const string& cacheDirectory, vector<CookResult>& assets)
+{
+	for (const auto& filePath : FileSystem::GetFilesInDirectory(directory))
+	{
+		// Engine format models and DDS files are loaded as they are
+		string extension = FileSystem::GetExtensionFromFilePath(filePath);
+		bool isModel = FileSystem::IsSupportedModelFile(filePath) && extension != MODEL_EXTENSION;
+		bool isTexture = FileSystem::IsSupportedImageFile(filePath) && extension != ".dds";
+		if (isModel || isTexture)
+		{
+			CookResult asset;
+			asset.filePath = filePath;
+			asset.isModel = isModel;
+			assets.push_back(asset);
+		}
+	}
+
+	for (const auto& subDirectory : FileSystem::GetDirectoriesInDirectory(directory))
+	{
+		if (FileSystem::NormalizePath(subDirectory + "/") == FileSystem::NormalizePath(cacheDirectory))
+			continue;
+
+		GetSourceAssets(subDirectory, cacheDirectory, assets);
+	}
+}
+
+// Collects every file of a directory and its subdirectories
+static void GetFiles(const string& directory, vector<string>& filePaths)
+{
+	for (const auto& filePath : FileSystem::GetFilesInDirectory(directory))
+	{
+		// Older archives don't go into the new one
+		if (FileSystem::GetExtensionFromFilePath(filePath) != ARCHIVE_EXTENSION)
+		{
+			filePaths.push_back(filePath);
+		}
+	}
+
+	for (const auto& subDirectory : FileSystem::GetDirectoriesInDirectory(directory))
+	{
+		GetFiles(subDirectory, filePaths);
+	}
+}
+
+static void PrintUsage()
+{
+	fprintf(stderr, "Usage: AssetCooker <project directory> [-j threads] [-nomips] [-pack archive [-compress]]\n");
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	string projectDirectory = FileSystem::NormalizePath(string(argv[1]) + "/");
+	unsigned int threadCount = max(thread::hardware_concurrency(), 1u);
+	bool generateMipmaps = true;
+	string archivePath;
+	bool compress = false;
+	for (int i = 2; i < argc; i++)
+	{
+		string argument = argv[i];
+		if (argument == "-j" && i + 1 < argc)
+		{
+			threadCount = max(atoi(argv[++i]), 1);
+		}
+		else if (argument == "-nomips")
+		{
+			generateMipmaps = false;
+		}
+		else if (argument == "-pack" && i + 1 < argc)
+		{
+			archivePath = argv[++i];
+		}
+		else if (argument == "-compress")
+		{
+			compress = true;
+		}
+		else
+		{
+			PrintUsage();
+			return 1;
+		}
+	}
+
+	if (!FileSystem::DirectoryExists(projectDirectory))
+	{
+		fprintf(stderr, "AssetCooker: \"%s\" is not a directory.\n", projectDirectory.c_str());
+		return 1;
+	}
+
+	auto logger = make_shared<ConsoleLogger>();
+	Log::SetLogger(logger);
+	FileSystem::Initialize();
+
+	// The same cache directory the runtime uses for the project
+	ImportCache importCache;
+	if (!importCache.Load(projectDirectory + "Cache/"))
+		return 1;
+
+	// Models go first, they take the longest and the textures fill in around them
+	vector<CookResult> results;
+	GetSourceAssets(projectDirectory, importCache.GetDirectory(), results);
+	sort(results.begin(), results.end(), [](const CookResult& a, const CookResult& b)
+	{
+		return a.isModel != b.isModel ? a.isModel : a.filePath < b.filePath;
+	});
+
+	// Each worker takes the next asset until there are none left
+	atomic<size_t> next(0);
+	mutex printMutex;
+	auto cook = [&]()
+	{
+		for (size_t i = next++; i < results.size(); i = next++)
+		{
+			auto start = chrono::high_resolution_clock::now();
+
+			CookResult& result = results[i];
+			string artefact = result.isModel ?
+				ModelCooker::Cook(&importCache, result.filePath, &result.upToDate) :
+				TextureCooker::Cook(&importCache, result.filePath, generateMipmaps, &result.upToDate);
+			result.success = !artefact.empty();
+			result.ms = chrono::duration<double, milli>(chrono::high_resolution_clock::now() - start).count();
+
+			lock_guard<mutex> lock(printMutex);
+			const char* status = !result.success ? "failed" : result.upToDate ? "up to date" : "cooked";
+			printf("%10.1f ms  %-10s  %s\n", result.ms, status, result.filePath.c_str());
+		}
+	};
+
+	auto start = chrono::high_resolution_clock::now();
+	vector<thread> workers;
+	for (unsigned int i = 0; i < min(threadCount, (unsigned int)max(results.size(), (size_t)1)); i++)
+	{
+		workers.emplace_back(cook);
+	}
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+	double seconds = chrono::duration<double>(chrono::high_resolution_clock::now() - start).count();
+
+	if (!importCache.Save())
+	{
+		fprintf(stderr, "AssetCooker: Failed to save the import cache.\n");
+		return 1;
+	}
+
+	int cooked = 0, upToDate = 0, failed = 0;
+	for (const auto& result : results)
+	{
+		cooked += result.success && !result.upToDate;
+		upToDate += result.success && result.upToDate;
+		failed += !result.success;
+	}
+	printf("%d assets in %.2f s on %u threads: %d cooked, %d up to date, %d failed\n", (int)results.size(), seconds, (unsigned int)workers.size(), cooked, upToDate, failed);
+
+	if (failed != 0)
+		return 1;
+
+	if (!archivePath.empty())
+	{
+		vector<string> packedFilePaths;
+		GetFiles(projectDirectory, packedFilePaths);
+		sort(packedFilePaths.begin(), packedFilePaths.end());
+
+		if (!AssetArchive::Build(archivePath, packedFilePaths, compress))
+			return 1;
+		printf("%d files packed into \"%s\"\n", (int)packedFilePaths.size(), archivePath.c_str());
+	}
+
+	return 0;
+}
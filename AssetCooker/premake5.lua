@@ -0,0 +1,48 @@
+-- Generated by Generate_VS17_Project.bat on Windows, run "premake5 gmake2" here on Linux
+PROJECT_NAME = "AssetCooker"
+
+-- Solution
+solution (PROJECT_NAME)
+	configurations { "Release" }
+	platforms { "x64" }
+	filter { "platforms:x64" }
+		architecture "x64"
+
+-- Project, only the parts of the runtime that don't need a graphics device
+project (PROJECT_NAME)
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++14"
+	files
+	{
+		"AssetCooker.cpp",
+		"../Runtime/Core/GUIDGenerator.cpp",
+		"../Runtime/FileSystem/FileSystem.cpp",
+		"../Runtime/FileSystem/AssetArchive.cpp",
+		"../Runtime/FileSystem/MappedFile.cpp",
+		"../Runtime/Graphics/Mesh.cpp",
+		"../Runtime/Graphics/MeshBVH.cpp",
+		"../Runtime/IO/StreamIO.cpp",
+		"../Runtime/Logging/Log.cpp",
+		"../Runtime/Math/**.cpp",
+		"../Runtime/Resource/Import/ImageImporter.cpp",
+		"../Runtime/Resource/Import/ImportCache.cpp",
+		"../Runtime/Resource/Import/ModelCooker.cpp",
+		"../Runtime/Resource/Import/TextureCooker.cpp"
+	}
+	includedirs { "../ThirdParty/Assimp_4.0.1", "../ThirdParty/FreeImage_3.17.0" }
+	defines { "COMPILING_LIB" }
+	targetdir "../Binaries/AssetCooker/%{cfg.buildcfg}"
+	objdir "../Binaries/AssetCooker/Obj/%{cfg.buildcfg}"
+
+filter "system:windows"
+	libdirs { "../ThirdParty/mvsc141_x64" }
+	links { "assimp", "FreeImageLib", "IrrXML.lib" }
+
+-- Assimp and FreeImage come from the system's packages on Linux
+filter "system:linux"
+	links { "assimp", "freeimage", "stdc++fs", "pthread" }
+
+filter "configurations:Release"
+	defines { "NDEBUG" }
+	optimize "Full"
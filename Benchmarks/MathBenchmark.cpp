@@ -0,0 +1,636 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+// Times the core Runtime/Math operations over batches of realistic size
+// and prints the results as JSON, so they can be compared across commits.
+//
+// Usage: MathBenchmark [output.json] [filter]
+// With no output path the JSON goes to stdout. When a filter is given,
+// only the benchmarks whose name contains it are run.
+//
+// Before timing anything, the results of the operations with SIMD paths are
+// checked against double precision references, within the tolerances below.
+// The Release (SSE) and ReleaseScalar (MATH_DISABLE_SIMD) builds run the same
+// checks, so both paths are held to the same bounds. A failure exits with 1.
+
+//= INCLUDES =======================
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+#include "../Runtime/Math/Vector3.h"
+#include "../Runtime/Math/Quaternion.h"
+#include "../Runtime/Math/Matrix.h"
+#include "../Runtime/Math/BoundingBox.h"
+#include "../Runtime/Math/Frustrum.h"
+#include "../Runtime/Math/Ray.h"
+//==================================
+
+//= NAMESPACES ================
+using namespace std;
+using namespace Directus::Math;
+//=============================
+
+struct BenchmarkResult
+{
+	string name;
+	int batch;
+	int samples;
+	double nsPerBatchMedian;
+	double nsPerBatchMin;
+};
+
+//= SETTINGS ======================================================
+static const int BATCH_SIZES[] = { 1024, 16384 };
+static const int SAMPLE_COUNT = 15;
+static const double MIN_SAMPLE_TIME_NS = 2.0 * 1000.0 * 1000.0; // 2ms
+//=================================================================
+
+//= TOLERANCES ====================================================
+// Relative to the magnitude of the inputs, float epsilon is ~1.2e-7
+static const double MULTIPLY_TOLERANCE = 1e-7;
+static const double TRANSFORM_POINT_TOLERANCE = 1e-6;
+static const double QUATERNION_TOLERANCE = 1e-6;
+// Also scaled by the condition number of the matrix, ill-conditioned inputs
+// lose digits in any float inverse and SSE and scalar differ most on them.
+static const double INVERSE_TOLERANCE = 1e-7;
+//=================================================================
+
+// Written to by every benchmark so that the work can't be optimized away
+static volatile float g_sink = 0.0f;
+
+static float Random(float min, float max)
+{
+	return min + (max - min) * (float)rand() / (float)RAND_MAX;
+}
+
+static Vector3 RandomVector3(float min, float max)
+{
+	return Vector3(Random(min, max), Random(min, max), Random(min, max));
+}
+
+static Quaternion RandomRotation()
+{
+	return Quaternion::FromEulerAngles(Random(-180.0f, 180.0f), Random(-180.0f, 180.0f), Random(-180.0f, 180.0f));
+}
+
+static Matrix RandomTransform()
+{
+	return Matrix(RandomVector3(-100.0f, 100.0f), RandomRotation(), RandomVector3(0.5f, 2.0f));
+}
+
+//= VERIFICATION ===========================================================================
+typedef double Matrix4d[4][4];
+
+static void ToDouble(const Matrix& m, Matrix4d out)
+{
+	const float rows[4][4] =
+	{
+		{ m.m00, m.m01, m.m02, m.m03 },
+		{ m.m10, m.m11, m.m12, m.m13 },
+		{ m.m20, m.m21, m.m22, m.m23 },
+		{ m.m30, m.m31, m.m32, m.m33 }
+	};
+
+	for (int r = 0; r < 4; r++)
+		for (int c = 0; c < 4; c++)
+			out[r][c] = rows[r][c];
+}
+
+static double MaxAbs(const Matrix4d m)
+{
+	double result = 0.0;
+	for (int r = 0; r < 4; r++)
+		for (int c = 0; c < 4; c++)
+			result = max(result, fabs(m[r][c]));
+	return result;
+}
+
+static double MaxDifference(const Matrix& m, const Matrix4d reference)
+{
+	Matrix4d md;
+	ToDouble(m, md);
+
+	double result = 0.0;
+	for (int r = 0; r < 4; r++)
+		for (int c = 0; c < 4; c++)
+			result = max(result, fabs(md[r][c] - reference[r][c]));
+	return result;
+}
+
+static double InfinityNorm(const Matrix4d m)
+{
+	double result = 0.0;
+	for (int r = 0; r < 4; r++)
+		result = max(result, fabs(m[r][0]) + fabs(m[r][1]) + fabs(m[r][2]) + fabs(m[r][3]));
+	return result;
+}
+
+// Gauss-Jordan elimination with partial pivoting
+static bool InvertReference(const Matrix4d m, Matrix4d out)
+{
+	double a[4][8];
+	for (int r = 0; r < 4; r++)
+	{
+		for (int c = 0; c < 4; c++)
+		{
+			a[r][c] = m[r][c];
+			a[r][c + 4] = r == c ? 1.0 : 0.0;
+		}
+	}
+
+	for (int c = 0; c < 4; c++)
+	{
+		int pivot = c;
+		for (int r = c + 1; r < 4; r++)
+			pivot = fabs(a[r][c]) > fabs(a[pivot][c]) ? r : pivot;
+		if (a[pivot][c] == 0.0)
+			return false;
+
+		for (int k = 0; k < 8; k++)
+			swap(a[c][k], a[pivot][k]);
+
+		double invPivot = 1.0 / a[c][c];
+		for (int k = 0; k < 8; k++)
+			a[c][k] *= invPivot;
+
+		for (int r = 0; r < 4; r++)
+		{
+			if (r == c)
+				continue;
+
+			double factor = a[r][c];
+			for (int k = 0; k < 8; k++)
+				a[r][k] -= factor * a[c][k];
+		}
+	}
+
+	for (int r = 0; r < 4; r++)
+		for (int c = 0; c < 4; c++)
+			out[r][c] = a[r][c + 4];
+	return true;
+}
+
+static double QuaternionDifference(const Quaternion& a, const Quaternion& b)
+{
+	return max(max(fabs((double)a.x - b.x), fabs((double)a.y - b.y)), max(fabs((double)a.z - b.z), fabs((double)a.w - b.w)));
+}
+
+// Returns false and prints the worst case of every check that fails
+static bool Verify()
+{
+	const int count = 4096 + 3; // not a multiple of four, so the scalar remainders run too
+	srand(1);
+
+	bool success = true;
+	auto check = [&success](const char* name, double error, double tolerance)
+	{
+		if (error > tolerance)
+		{
+			fprintf(stderr, "MathBenchmark: %s is off by %g, the tolerance is %g.\n", name, error, tolerance);
+			success = false;
+		}
+	};
+
+	//= MATRIX ==============================================
+	double multiplyError = 0.0, transposeError = 0.0, pointError = 0.0, inverseError = 0.0;
+	for (int i = 0; i < count; i++)
+	{
+		// Every fourth matrix has a wildly non-uniform scale, which makes it ill-conditioned
+		Vector3 scale = i % 4 == 0 ? Vector3(Random(0.001f, 0.01f), Random(100.0f, 1000.0f), Random(0.5f, 2.0f)) : RandomVector3(0.5f, 2.0f);
+		Matrix a = Matrix(RandomVector3(-100.0f, 100.0f), RandomRotation(), scale);
+		Matrix b = RandomTransform();
+		Vector3 point = RandomVector3(-100.0f, 100.0f);
+
+		Matrix4d ad, bd, reference;
+		ToDouble(a, ad);
+		ToDouble(b, bd);
+
+		for (int r = 0; r < 4; r++)
+			for (int c = 0; c < 4; c++)
+				reference[r][c] = ad[r][0] * bd[0][c] + ad[r][1] * bd[1][c] + ad[r][2] * bd[2][c] + ad[r][3] * bd[3][c];
+		multiplyError = max(multiplyError, MaxDifference(a * b, reference) / (4.0 * MaxAbs(ad) * MaxAbs(bd)));
+
+		for (int r = 0; r < 4; r++)
+			for (int c = 0; c < 4; c++)
+				reference[r][c] = ad[c][r];
+		transposeError = max(transposeError, MaxDifference(Matrix::Transpose(a), reference));
+
+		double w = point.x * ad[0][3] + point.y * ad[1][3] + point.z * ad[2][3] + ad[3][3];
+		double expected[3];
+		for (int c = 0; c < 3; c++)
+			expected[c] = (point.x * ad[0][c] + point.y * ad[1][c] + point.z * ad[2][c] + ad[3][c]) / w;
+		Vector3 transformed = a * point;
+		double magnitude = MaxAbs(ad) * (fabs(point.x) + fabs(point.y) + fabs(point.z) + 1.0);
+		pointError = max(pointError, max(max(fabs(transformed.x - expected[0]), fabs(transformed.y - expected[1])), fabs(transformed.z - expected[2])) / magnitude);
+
+		if (InvertReference(ad, reference))
+		{
+			double condition = InfinityNorm(ad) * InfinityNorm(reference);
+			inverseError = max(inverseError, MaxDifference(Matrix::Invert(a), reference) / (MaxAbs(reference) * condition));
+		}
+	}
+	check("Matrix::operator*(Matrix)", multiplyError, MULTIPLY_TOLERANCE);
+	check("Matrix::Transpose", transposeError, 0.0);
+	check("Matrix::operator*(Vector3)", pointError, TRANSFORM_POINT_TOLERANCE);
+	check("Matrix::Invert", inverseError, INVERSE_TOLERANCE);
+	//=======================================================
+
+	//= QUATERNION ==========================================
+	vector<Quaternion> quatA(count), quatB(count), quatOut(count), normalized(count);
+	vector<Vector3> vectors(count), vectorsOut(count);
+	vector<float> t(count);
+	for (int i = 0; i < count; i++)
+	{
+		quatA[i] = RandomRotation();
+		quatB[i] = RandomRotation();
+		vectors[i] = RandomVector3(-1.0f, 1.0f);
+		t[i] = Random(0.0f, 1.0f);
+		normalized[i] = Quaternion(quatA[i].x * 3.0f, quatA[i].y * 3.0f, quatA[i].z * 3.0f, quatA[i].w * 3.0f);
+	}
+
+	double error = 0.0;
+	Quaternion::MultiplyBatch(quatA.data(), quatB.data(), quatOut.data(), count);
+	for (int i = 0; i < count; i++)
+		error = max(error, QuaternionDifference(quatOut[i], quatA[i] * quatB[i]));
+	check("Quaternion::MultiplyBatch", error, QUATERNION_TOLERANCE);
+
+	error = 0.0;
+	Quaternion::RotateBatch(quatA.data(), vectors.data(), vectorsOut.data(), count);
+	for (int i = 0; i < count; i++)
+	{
+		Vector3 expected = quatA[i] * vectors[i];
+		error = max(error, (double)max(max(fabsf(vectorsOut[i].x - expected.x), fabsf(vectorsOut[i].y - expected.y)), fabsf(vectorsOut[i].z - expected.z)));
+	}
+	check("Quaternion::RotateBatch", error, QUATERNION_TOLERANCE);
+
+	error = 0.0;
+	Quaternion::NormalizeBatch(normalized.data(), count);
+	for (int i = 0; i < count; i++)
+		error = max(error, QuaternionDifference(normalized[i], quatA[i].Normalized()));
+	check("Quaternion::NormalizeBatch", error, QUATERNION_TOLERANCE);
+
+	// Interpolations against the textbook formulas, along the shortest path
+	double nlerpError = 0.0, slerpError = 0.0;
+	vector<Quaternion> slerped(count);
+	Quaternion::NlerpBatch(quatA.data(), quatB.data(), t.data(), quatOut.data(), count);
+	Quaternion::SlerpBatch(quatA.data(), quatB.data(), t.data(), slerped.data(), count);
+	for (int i = 0; i < count; i++)
+	{
+		const Quaternion& a = quatA[i];
+		const Quaternion& b = quatB[i];
+		double dot = (double)a.x * b.x + (double)a.y * b.y + (double)a.z * b.z + (double)a.w * b.w;
+		double sign = dot < 0.0 ? -1.0 : 1.0;
+		dot *= sign;
+
+		double from = 1.0 - t[i], to = t[i];
+		double lerp[4] = { a.x * from + b.x * sign * to, a.y * from + b.y * sign * to, a.z * from + b.z * sign * to, a.w * from + b.w * sign * to };
+		double length = sqrt(lerp[0] * lerp[0] + lerp[1] * lerp[1] + lerp[2] * lerp[2] + lerp[3] * lerp[3]);
+		nlerpError = max(nlerpError, QuaternionDifference(quatOut[i], Quaternion((float)(lerp[0] / length), (float)(lerp[1] / length), (float)(lerp[2] / length), (float)(lerp[3] / length))));
+
+		if (dot < 0.9995) // the scalar path falls back to nlerp above this
+		{
+			double theta = acos(min(dot, 1.0));
+			from = sin((1.0 - t[i]) * theta) / sin(theta);
+			to = sin(t[i] * theta) / sin(theta) * sign;
+			Quaternion expected((float)(a.x * from + b.x * to), (float)(a.y * from + b.y * to), (float)(a.z * from + b.z * to), (float)(a.w * from + b.w * to));
+			slerpError = max(slerpError, QuaternionDifference(slerped[i], expected));
+		}
+	}
+	check("Quaternion::NlerpBatch", nlerpError, QUATERNION_TOLERANCE);
+	check("Quaternion::SlerpBatch", slerpError, QUATERNION_TOLERANCE);
+	//=======================================================
+
+	return success;
+}
+//==========================================================================================
+
+// Runs the batch enough times per sample for the timer to be meaningful
+// and keeps the median of all the samples.
+static BenchmarkResult Measure(const string& name, int batch, const function<void()>& run)
+{
+	typedef chrono::high_resolution_clock Clock;
+
+	// Warm up caches and find out how many runs fill a sample
+	int runsPerSample = 1;
+	while (true)
+	{
+		auto start = Clock::now();
+		for (int i = 0; i < runsPerSample; i++)
+			run();
+		double elapsed = (double)chrono::duration_cast<chrono::nanoseconds>(Clock::now() - start).count();
+
+		if (elapsed >= MIN_SAMPLE_TIME_NS || runsPerSample >= (1 << 20))
+			break;
+		runsPerSample *= 2;
+	}
+
+	vector<double> samples;
+	for (int s = 0; s < SAMPLE_COUNT; s++)
+	{
+		auto start = Clock::now();
+		for (int i = 0; i < runsPerSample; i++)
+			run();
+		double elapsed = (double)chrono::duration_cast<chrono::nanoseconds>(Clock::now() - start).count();
+		samples.push_back(elapsed / runsPerSample);
+	}
+	sort(samples.begin(), samples.end());
+
+	BenchmarkResult result;
+	result.name = name;
+	result.batch = batch;
+	result.samples = SAMPLE_COUNT;
+	result.nsPerBatchMedian = samples[samples.size() / 2];
+	result.nsPerBatchMin = samples.front();
+	return result;
+}
+
+static void RunBenchmarks(int batch, const string& filter, vector<BenchmarkResult>& results)
+{
+	auto add = [&](const string& name, const function<void()>& run)
+	{
+		if (!filter.empty() && name.find(filter) == string::npos)
+			return;
+
+		results.push_back(Measure(name, batch, run));
+	};
+
+	srand(batch);
+
+	//= INPUT ===============================================
+	vector<Matrix> matricesA(batch), matricesB(batch), matricesOut(batch);
+	vector<const Matrix*> matrixPointers(batch);
+	vector<Quaternion> quatA(batch), quatB(batch), quatOut(batch);
+	vector<float> t(batch);
+	vector<Vector3> points(batch), pointsOut(batch), centers(batch), extents(batch);
+	vector<BoundingBox> boxes(batch);
+	vector<Ray> rays(batch);
+	for (int i = 0; i < batch; i++)
+	{
+		matricesA[i] = RandomTransform();
+		matricesB[i] = RandomTransform();
+		matrixPointers[i] = &matricesA[i];
+		quatA[i] = RandomRotation();
+		quatB[i] = RandomRotation();
+		t[i] = Random(0.0f, 1.0f);
+		points[i] = RandomVector3(-100.0f, 100.0f);
+		centers[i] = RandomVector3(-500.0f, 500.0f);
+		extents[i] = RandomVector3(0.5f, 10.0f);
+		boxes[i] = BoundingBox(centers[i] - extents[i], centers[i] + extents[i]);
+		rays[i] = Ray(RandomVector3(-500.0f, 500.0f), RandomVector3(-500.0f, 500.0f));
+	}
+
+	Frustrum frustrum;
+	Matrix view = Matrix::CreateLookAtLH(Vector3(0.0f, 10.0f, -50.0f), Vector3::Zero, Vector3::Up);
+	Matrix projection = Matrix::CreatePerspectiveFieldOfViewLH(1.0f, 16.0f / 9.0f, 0.3f, 1000.0f);
+	frustrum.Construct(view, projection, 1000.0f);
+
+	vector<float> soa(batch * 6);
+	float* cx = &soa[0];			float* cy = &soa[batch];		float* cz = &soa[batch * 2];
+	float* ex = &soa[batch * 3];	float* ey = &soa[batch * 4];	float* ez = &soa[batch * 5];
+	for (int i = 0; i < batch; i++)
+	{
+		cx[i] = centers[i].x; cy[i] = centers[i].y; cz[i] = centers[i].z;
+		ex[i] = extents[i].x; ey[i] = extents[i].y; ez[i] = extents[i].z;
+	}
+	vector<unsigned int> visibility, intersecting;
+	//=======================================================
+
+	//= MATRIX ==============================================
+	add("matrix_multiply", [&]()
+	{
+		for (int i = 0; i < batch; i++)
+			matricesOut[i] = matricesA[i] * matricesB[i];
+		g_sink = matricesOut[batch - 1].m00;
+	});
+
+	add("matrix_inverse", [&]()
+	{
+		for (int i = 0; i < batch; i++)
+			matricesOut[i] = Matrix::Invert(matricesA[i]);
+		g_sink = matricesOut[batch - 1].m00;
+	});
+
+	add("matrix_transpose", [&]()
+	{
+		for (int i = 0; i < batch; i++)
+			matricesOut[i] = Matrix::Transpose(matricesA[i]);
+		g_sink = matricesOut[batch - 1].m00;
+	});
+
+	add("matrix_decompose", [&]()
+	{
+		Vector3 scale, translation;
+		Quaternion rotation;
+		float sum = 0.0f;
+		for (int i = 0; i < batch; i++)
+		{
+			matricesA[i].Decompose(scale, rotation, translation);
+			sum += scale.x + rotation.w + translation.x;
+		}
+		g_sink = sum;
+	});
+
+	add("matrix_transform_point", [&]()
+	{
+		float sum = 0.0f;
+		for (int i = 0; i < batch; i++)
+			sum += (matricesA[i] * points[i]).x;
+		g_sink = sum;
+	});
+	//=======================================================
+
+	//= QUATERNION ==========================================
+	add("quaternion_multiply_batch", [&]()
+	{
+		Quaternion::MultiplyBatch(quatA.data(), quatB.data(), quatOut.data(), batch);
+		g_sink = quatOut[batch - 1].w;
+	});
+
+	add("quaternion_rotate_batch", [&]()
+	{
+		Quaternion::RotateBatch(quatA.data(), points.data(), pointsOut.data(), batch);
+		g_sink = pointsOut[batch - 1].x;
+	});
+
+	add("quaternion_normalize_batch", [&]()
+	{
+		// Normalizes in place, the work is the same whether the input is normalized or not
+		Quaternion::NormalizeBatch(quatOut.data(), batch);
+		g_sink = quatOut[batch - 1].w;
+	});
+
+	add("quaternion_nlerp_batch", [&]()
+	{
+		Quaternion::NlerpBatch(quatA.data(), quatB.data(), t.data(), quatOut.data(), batch);
+		g_sink = quatOut[batch - 1].w;
+	});
+
+	add("quaternion_slerp_batch", [&]()
+	{
+		Quaternion::SlerpBatch(quatA.data(), quatB.data(), t.data(), quatOut.data(), batch);
+		g_sink = quatOut[batch - 1].w;
+	});
+	//=======================================================
+
+	//= BOUNDING BOX ========================================
+	add("boundingbox_transform", [&]()
+	{
+		float sum = 0.0f;
+		for (int i = 0; i < batch; i++)
+			sum += boxes[i].Transformed(matricesA[i]).min.x;
+		g_sink = sum;
+	});
+
+	add("boundingbox_transform_batch", [&]()
+	{
+		BoundingBox::TransformBatch(centers.data(), extents.data(), matrixPointers.data(), batch, cx, cy, cz, ex, ey, ez);
+		g_sink = cx[batch - 1];
+	});
+	//=======================================================
+
+	// The batched transform above overwrote the SoA bounds, re-fill them
+	for (int i = 0; i < batch; i++)
+	{
+		cx[i] = centers[i].x; cy[i] = centers[i].y; cz[i] = centers[i].z;
+		ex[i] = extents[i].x; ey[i] = extents[i].y; ez[i] = extents[i].z;
+	}
+
+	//= FRUSTRUM ============================================
+	add("frustrum_check_cube", [&]()
+	{
+		int visible = 0;
+		for (int i = 0; i < batch; i++)
+			visible += frustrum.CheckCube(centers[i], extents[i]) != Outside;
+		g_sink = (float)visible;
+	});
+
+	add("frustrum_check_cubes_batch", [&]()
+	{
+		frustrum.CheckCubes(cx, cy, cz, ex, ey, ez, batch, visibility);
+		g_sink = (float)visibility[0];
+	});
+
+	add("frustrum_check_spheres_batch", [&]()
+	{
+		// The extents double as radii, only the amount of work matters here
+		frustrum.CheckSpheres(cx, cy, cz, ex, batch, visibility, intersecting);
+		g_sink = (float)visibility[0];
+	});
+	//=======================================================
+
+	//= RAY =================================================
+	add("ray_box_hit_distance", [&]()
+	{
+		float sum = 0.0f;
+		for (int i = 0; i < batch; i++)
+		{
+			float distance = rays[i].HitDistance(boxes[i]);
+			sum += distance == INFINITY ? 0.0f : distance;
+		}
+		g_sink = sum;
+	});
+	//=======================================================
+}
+
+static string GetSimdName()
+{
+#if defined(MATH_SIMD_AVX)
+	return "avx";
+#elif defined(MATH_SIMD_SSE)
+	return "sse";
+#else
+	return "scalar";
+#endif
+}
+
+static string GetCompilerName()
+{
+#if defined(__clang__)
+	return "clang " + to_string(__clang_major__) + "." + to_string(__clang_minor__);
+#elif defined(__GNUC__)
+	return "gcc " + to_string(__GNUC__) + "." + to_string(__GNUC_MINOR__);
+#elif defined(_MSC_VER)
+	return "msvc " + to_string(_MSC_VER);
+#else
+	return "unknown";
+#endif
+}
+
+static void WriteJson(FILE* file, const vector<BenchmarkResult>& results)
+{
+	fprintf(file, "{\n");
+	fprintf(file, "\t\"suite\": \"math\",\n");
+	fprintf(file, "\t\"simd\": \"%s\",\n", GetSimdName().c_str());
+	fprintf(file, "\t\"compiler\": \"%s\",\n", GetCompilerName().c_str());
+	fprintf(file, "\t\"results\": [\n");
+	for (unsigned int i = 0; i < results.size(); i++)
+	{
+		const BenchmarkResult& result = results[i];
+		fprintf(file,
+			"\t\t{ \"name\": \"%s\", \"batch\": %d, \"samples\": %d, \"ns_per_batch\": %.1f, \"ns_per_batch_min\": %.1f, \"ns_per_op\": %.3f }%s\n",
+			result.name.c_str(),
+			result.batch,
+			result.samples,
+			result.nsPerBatchMedian,
+			result.nsPerBatchMin,
+			result.nsPerBatchMedian / result.batch,
+			i + 1 < results.size() ? "," : ""
+		);
+	}
+	fprintf(file, "\t]\n");
+	fprintf(file, "}\n");
+}
+
+int main(int argc, char** argv)
+{
+	string outputPath = argc > 1 ? argv[1] : "";
+	string filter = argc > 2 ? argv[2] : "";
+
+	if (!Verify())
+		return 1;
+
+	vector<BenchmarkResult> results;
+	for (int batch : BATCH_SIZES)
+	{
+		RunBenchmarks(batch, filter, results);
+	}
+
+	FILE* file = outputPath.empty() ? stdout : fopen(outputPath.c_str(), "w");
+	if (!file)
+	{
+		fprintf(stderr, "MathBenchmark: Failed to open \"%s\" for writing.\n", outputPath.c_str());
+		return 1;
+	}
+
+	WriteJson(file, results);
+
+	if (file != stdout)
+	{
+		fclose(file);
+	}
+
+	return 0;
+}
@@ -0,0 +1,27 @@
+-- Generate with "premake5 gmake2" (Linux) or "premake5 vs2017" (Windows)
+PROJECT_NAME = "MathBenchmark"
+
+-- Solution
+solution (PROJECT_NAME)
+	configurations { "Release", "ReleaseScalar" }
+	platforms { "x64" }
+	filter { "platforms:x64" }
+		architecture "x64"
+
+-- Project
+project (PROJECT_NAME)
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++14"
+	files { "MathBenchmark.cpp", "../Runtime/Math/**.h", "../Runtime/Math/**.cpp" }
+	targetdir "../Binaries/Benchmarks/%{cfg.buildcfg}"
+	objdir "../Binaries/Benchmarks/Obj/%{cfg.buildcfg}"
+
+filter "configurations:Release"
+	defines { "NDEBUG" }
+	optimize "Full"
+
+-- The same code with the SIMD paths compiled out, to compare against
+filter "configurations:ReleaseScalar"
+	defines { "NDEBUG", "MATH_DISABLE_SIMD" }
+	optimize "Full"
@@ -32,6 +32,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "Math/Vector2.h"
 #include "DirectusInspector.h"
 #include "Graphics/Renderer.h"
+#include "Resource/ResourceManager.h"
 //============================
 
 //= NAMESPACES ================
@@ -78,6 +79,9 @@ void DirectusViewport::Initialize(void* mainWindowHandle, void* hInstance)
 
     m_context = m_engine->GetContext();
     m_renderer = m_context->GetSubsystem<Renderer>();
+
+    // Pick up changes made to the project's assets while editing
+    m_context->GetSubsystem<ResourceManager>()->SetHotReload(true);
 }
 
 bool DirectusViewport::IsRunning()
@@ -2,4 +2,6 @@
 cd Runtime
 xcopy "Assets" "..\Binaries\Release\Standard Assets\" /E /I
 premake5 vs2017
+cd ..\AssetCooker
+..\Runtime\premake5 vs2017
 pause
\ No newline at end of file
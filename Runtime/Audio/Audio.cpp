@@ -42,6 +42,7 @@ namespace Directus
 		m_initialized = false;
 
 		m_listener = nullptr;
+		m_listenerVersion = 0;
 		m_pos = { 0, 0, 0 };
 		m_vel = { 0, 0, 0 };
 		m_for = { 0, 0, -1 };
@@ -140,8 +141,10 @@ namespace Directus
 		}
 
 		//= 3D Attributes =================================================================
-		if (m_listener)
+		if (m_listener && m_listenerVersion != m_listener->GetVersion())
 		{
+			m_listenerVersion = m_listener->GetVersion();
+
 			Math::Vector3 pos = m_listener->GetPosition();
 			Math::Vector3 forward = m_listener->GetForward();
 			Math::Vector3 up = m_listener->GetUp();
@@ -178,5 +181,6 @@ namespace Directus
 	void Audio::SetListenerTransform(Transform* transform)
 	{
 		m_listener = transform;
+		m_listenerVersion = 0;
 	}
 }
\ No newline at end of file
@@ -59,6 +59,7 @@ namespace Directus
 
 		//= LISTENER =========
 		Transform* m_listener;
+		unsigned int m_listenerVersion;
 		FMOD_VECTOR m_pos;
 		FMOD_VECTOR m_vel;
 		FMOD_VECTOR m_for;
@@ -44,6 +44,7 @@ namespace Directus
 
 		// AudioClip
 		m_transform = nullptr;
+		m_transformVersion = 0;
 		m_fModSystem = fModSystem;
 		m_result = FMOD_OK;
 		m_sound = nullptr;
@@ -102,6 +103,9 @@ namespace Directus
 			return false;
 		}
 
+		// A new channel, make sure it gets the 3D attributes
+		m_transformVersion = 0;
+
 		return true;
 	}
 
@@ -295,6 +299,11 @@ namespace Directus
 		if (!m_transform || !m_channel)
 			return false;
 
+		// The channel already has the latest 3D attributes
+		if (m_transformVersion == m_transform->GetVersion())
+			return true;
+		m_transformVersion = m_transform->GetVersion();
+
 		Vector3 pos = m_transform->GetPosition();
 
 		FMOD_VECTOR fModPos = { pos.x, pos.y, pos.z };
@@ -89,7 +89,7 @@ namespace Directus
 		bool SetRolloff(Rolloff rolloff);
 
 		// Makes the audio use the 3D attributes of the transform
-		void SetTransform(Transform* transform) { m_transform = transform; }
+		void SetTransform(Transform* transform) { m_transform = transform; m_transformVersion = 0; }
 
 		// Should be called per frame to update the 3D attributes of the sound
 		bool Update();
@@ -104,6 +104,7 @@ namespace Directus
 		int BuildSoundMode();
 
 		Transform* m_transform;
+		unsigned int m_transformVersion;
 		FMOD::System* m_fModSystem;
 		int m_result;
 		FMOD::Sound* m_sound;
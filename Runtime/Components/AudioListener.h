@@ -43,8 +43,8 @@ namespace Directus
 		virtual void OnDisable();
 		virtual void Remove();
 		virtual void Update();
-		virtual void Serialize();
-		virtual void Deserialize();
+		virtual void Serialize(StreamIO* stream);
+		virtual void Deserialize(StreamIO* stream);
 
 	private:
 		Audio* m_audio;
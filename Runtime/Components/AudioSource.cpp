@@ -105,28 +105,28 @@ namespace Directus
 		m_audioClip._Get()->Update();
 	}
 	
-	void AudioSource::Serialize()
-	{
-		StreamIO::WriteSTR(m_filePath);
-		StreamIO::WriteBool(m_mute);
-		StreamIO::WriteBool(m_playOnAwake);
-		StreamIO::WriteBool(m_loop);
-		StreamIO::WriteInt(m_priority);
-		StreamIO::WriteFloat(m_volume);
-		StreamIO::WriteFloat(m_pitch);
-		StreamIO::WriteFloat(m_pan);
-	}
-	
-	void AudioSource::Deserialize()
-	{
-		m_filePath = StreamIO::ReadSTR();
-		m_mute = StreamIO::ReadBool();
-		m_playOnAwake = StreamIO::ReadBool();
-		m_loop = StreamIO::ReadBool();
-		m_priority = StreamIO::ReadInt();
-		m_volume = StreamIO::ReadFloat();
-		m_pitch = StreamIO::ReadFloat();
-		m_pan = StreamIO::ReadFloat();
+	void AudioSource::Serialize(StreamIO* stream)
+	{
+		stream->WriteSTR(m_filePath);
+		stream->WriteBool(m_mute);
+		stream->WriteBool(m_playOnAwake);
+		stream->WriteBool(m_loop);
+		stream->WriteInt(m_priority);
+		stream->WriteFloat(m_volume);
+		stream->WriteFloat(m_pitch);
+		stream->WriteFloat(m_pan);
+	}
+	
+	void AudioSource::Deserialize(StreamIO* stream)
+	{
+		m_filePath = stream->ReadSTR();
+		m_mute = stream->ReadBool();
+		m_playOnAwake = stream->ReadBool();
+		m_loop = stream->ReadBool();
+		m_priority = stream->ReadInt();
+		m_volume = stream->ReadFloat();
+		m_pitch = stream->ReadFloat();
+		m_pan = stream->ReadFloat();
 	
 		LoadAudioClip(m_filePath);
 	}
@@ -50,6 +50,7 @@ namespace Directus
 		m_projection = Perspective;
 		m_clearColor = Vector4(0.396f, 0.611f, 0.937f, 1.0f); // A nice cornflower blue 
 		m_isDirty = false;
+		m_lastKnownTransformVersion = 0;
 	}
 
 	Camera::~Camera()
@@ -89,10 +90,9 @@ namespace Directus
 		}
 
 		// DIRTY CHECK
-		if (m_position != g_transform->GetPosition() || m_rotation != g_transform->GetRotation())
+		if (m_lastKnownTransformVersion != g_transform->GetVersion())
 		{
-			m_position = g_transform->GetPosition();
-			m_rotation = g_transform->GetRotation();
+			m_lastKnownTransformVersion = g_transform->GetVersion();
 			m_isDirty = true;
 		}
 
@@ -108,22 +108,22 @@ namespace Directus
 		m_isDirty = false;
 	}
 
-	void Camera::Serialize()
+	void Camera::Serialize(StreamIO* stream)
 	{
-		StreamIO::WriteVector4(m_clearColor);
-		StreamIO::WriteInt(int(m_projection));
-		StreamIO::WriteFloat(m_fovHorizontal);
-		StreamIO::WriteFloat(m_nearPlane);
-		StreamIO::WriteFloat(m_farPlane);
+		stream->WriteVector4(m_clearColor);
+		stream->WriteInt(int(m_projection));
+		stream->WriteFloat(m_fovHorizontal);
+		stream->WriteFloat(m_nearPlane);
+		stream->WriteFloat(m_farPlane);
 	}
 
-	void Camera::Deserialize()
+	void Camera::Deserialize(StreamIO* stream)
 	{
-		m_clearColor = StreamIO::ReadVector4();
-		m_projection = Projection(StreamIO::ReadInt());
-		m_fovHorizontal = StreamIO::ReadFloat();
-		m_nearPlane = StreamIO::ReadFloat();
-		m_farPlane = StreamIO::ReadFloat();
+		m_clearColor = stream->ReadVector4();
+		m_projection = Projection(stream->ReadInt());
+		m_fovHorizontal = stream->ReadFloat();
+		m_nearPlane = stream->ReadFloat();
+		m_farPlane = stream->ReadFloat();
 
 		CalculateBaseView();
 		CalculateViewMatrix();
@@ -162,11 +162,13 @@ namespace Directus
 
 	bool Camera::IsInViewFrustrum(MeshFilter* meshFilter)
 	{
-		BoundingBox box = meshFilter->GetBoundingBoxTransformed();
-		Vector3 center = box.GetCenter();
-		Vector3 extents = box.GetHalfSize();
+		// Cheap sphere test first, the box is only needed when the sphere crosses a plane
+		const BoundingSphere& sphere = meshFilter->GetBoundingSphereTransformed();
+		Intersection result = m_frustrum->CheckSphere(sphere.center, sphere.radius);
+		if (result != Intersects)
+			return result == Inside;
 
-		return m_frustrum->CheckCube(center, extents) != Outside;
+		return m_frustrum->CheckOrientedBox(meshFilter->GetOrientedBoundingBox()) != Outside;
 	}
 
 	bool Camera::IsInViewFrustrum(const Vector3& center, const Vector3& extents)
@@ -198,75 +200,10 @@ namespace Directus
 		// Compute ray given the origin and end
 		m_ray = Ray(g_transform->GetPosition(), ScreenToWorldPoint(mouse));
 
-		// We use the boundibg box of each mesh to determine find and return the 
-		// one that's nearest to the camera. However, there are scenarios where
-		// hollow meshes (let's say a building) will have a large bounding box
-		// which will contain other bounding boxes and potentially even the camera.
-		// In a scenario like this, the hit distance of the large bounding box
-		// will be zero, and it will be picked every time. Because this is unlikely
-		// what the user would want to do (e.g. in a building, trying to pick contained objects),
-		// we reject any bounding boxes that contain the camera and return them only
-		// if nothing else was hit. Hence bounding boxes inside a larger one can 
-		// be picked. It feels more intuitive.
-
-		// Nearest mesh
-		float hitDistanceMin = INFINITY;
-		weakGameObj nearestGameObj;
-
-		// A mesh we are potentialy inside of
-		vector<weakGameObj> containerGameObj;
-
-		// Find the GameObject nearest to the camera
-		vector<weakGameObj> gameObjects = g_context->GetSubsystem<Scene>()->GetRenderables();
-		for (const auto& gameObj : gameObjects)
-		{
-			if (gameObj._Get()->HasComponent<Skybox>())
-				continue;
-
-			if (!gameObj._Get()->HasComponent<MeshFilter>())
-				continue;
-
-			BoundingBox box = gameObj._Get()->GetComponent<MeshFilter>()->GetBoundingBoxTransformed();
-
-			// Ignore collision if we are inside the bounding box
-			// but keep those container bounding boxes
-			if (box.IsInside(g_transform->GetPosition()))
-			{
-				containerGameObj.push_back(gameObj);
-				continue;
-			}
-
-			float hitDistance = m_ray.HitDistance(box);
-			if (hitDistance < hitDistanceMin)
-			{
-				hitDistanceMin = hitDistance;
-				nearestGameObj = gameObj;
-			}
-		}
-
-		weakGameObj pickedGameObj = nearestGameObj;
-
-		// In case there is no nearest GameObject, go through the 
-		// containg GameObjects and return the one whose center 
-		// is nearest to the camera's position.
-		if (nearestGameObj.expired())
-		{
-			float distanceMin = INFINITY;
-
-			for (const auto& gameObj : containerGameObj)
-			{
-				BoundingBox box = gameObj._Get()->GetComponent<MeshFilter>()->GetBoundingBoxTransformed();
-				float distance = Vector3::LengthSquared(g_transform->GetPosition(), box.GetCenter());
-
-				if (distance < distanceMin)
-				{
-					distanceMin = distance;
-					pickedGameObj = gameObj;
-				}
-			}
-		}
-
-		return pickedGameObj;
+		// The scene tests against the actual triangles of each mesh, so a large
+		// hollow mesh (let's say a building) containing the camera doesn't
+		// get in the way of picking the meshes inside of it.
+		return g_context->GetSubsystem<Scene>()->Raycast(m_ray);
 	}
 	
 	Vector2 Camera::WorldToScreenPoint(const Vector3& worldPoint)
@@ -63,8 +63,8 @@ namespace Directus
 		virtual void OnDisable();
 		virtual void Remove();
 		virtual void Update();
-		virtual void Serialize();
-		virtual void Deserialize();
+		virtual void Serialize(StreamIO* stream);
+		virtual void Deserialize(StreamIO* stream);
 		//=========================
 
 		//= MATRICES ===============================================
@@ -104,6 +104,7 @@ namespace Directus
 		//= MISC ========================================================================
 		bool IsInViewFrustrum(MeshFilter* meshFilter);
 		bool IsInViewFrustrum(const Math::Vector3& center, const Math::Vector3& extents);
+		Math::Frustrum* GetFrustrum() { return m_frustrum.get(); }
 		Math::Vector4 GetClearColor() { return m_clearColor; }
 		void SetClearColor(const Math::Vector4& color) { m_clearColor = color; }
 		//===============================================================================
@@ -125,8 +126,7 @@ namespace Directus
 		Math::Matrix m_mProjection;
 		Math::Matrix m_mBaseView;
 
-		Math::Vector3 m_position;
-		Math::Quaternion m_rotation;
+		unsigned int m_lastKnownTransformVersion;
 		bool m_isDirty;
 
 		Math::Vector2 m_lastKnownResolution;	
@@ -71,6 +71,7 @@ namespace Directus
 		}
 
 		m_lastKnownScale = g_transform->GetScale();
+		m_lastKnownTransformVersion = g_transform->GetVersion();
 		UpdateShape();
 	}
 
@@ -91,6 +92,11 @@ namespace Directus
 
 	void Collider::Update()
 	{
+		// Nothing moved, nothing to do
+		if (m_lastKnownTransformVersion == g_transform->GetVersion())
+			return;
+		m_lastKnownTransformVersion = g_transform->GetVersion();
+
 		// Scale the collider if the transform scale has changed
 		if (m_lastKnownScale != g_transform->GetScale())
 		{	
@@ -99,18 +105,18 @@ namespace Directus
 		}
 	}
 
-	void Collider::Serialize()
+	void Collider::Serialize(StreamIO* stream)
 	{
-		StreamIO::WriteInt(int(m_shapeType));
-		StreamIO::WriteVector3(m_extents);
-		StreamIO::WriteVector3(m_center);
+		stream->WriteInt(int(m_shapeType));
+		stream->WriteVector3(m_extents);
+		stream->WriteVector3(m_center);
 	}
 
-	void Collider::Deserialize()
+	void Collider::Deserialize(StreamIO* stream)
 	{
-		m_shapeType = ColliderShape(StreamIO::ReadInt());
-		m_extents = StreamIO::ReadVector3();
-		m_center = StreamIO::ReadVector3();
+		m_shapeType = ColliderShape(stream->ReadInt());
+		m_extents = stream->ReadVector3();
+		m_center = stream->ReadVector3();
 
 		UpdateShape();
 	}
@@ -56,8 +56,8 @@ namespace Directus
 		virtual void OnDisable();
 		virtual void Remove();
 		virtual void Update();
-		virtual void Serialize();
-		virtual void Deserialize();
+		virtual void Serialize(StreamIO* stream);
+		virtual void Deserialize(StreamIO* stream);
 		//==========================
 
 		// Bounding box
@@ -89,6 +89,7 @@ namespace Directus
 		Math::Vector3 m_extents;
 		Math::Vector3 m_center;
 		Math::Vector3 m_lastKnownScale;
+		unsigned int m_lastKnownTransformVersion;
 		std::weak_ptr<Mesh> m_mesh;
 	};
 }
\ No newline at end of file
@@ -43,6 +43,7 @@ namespace Directus
 	class TexturePool;
 	class ShaderPool;
 	class Context;
+	class StreamIO;
 
 	class DLL_API Component
 	{
@@ -68,10 +69,10 @@ namespace Directus
 		virtual void Update() = 0;
 
 		// Runs when the GameObject is being saved
-		virtual void Serialize() = 0;
+		virtual void Serialize(StreamIO* stream) = 0;
 
 		// Runs when the GameObject is being loaded
-		virtual void Deserialize() = 0;
+		virtual void Deserialize(StreamIO* stream) = 0;
 
 		// Should be called by the derived component to register it's type
 		void Register()
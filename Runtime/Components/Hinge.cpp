@@ -88,37 +88,37 @@ namespace Directus
 		m_isDirty = false;
 	}
 
-	void Hinge::Serialize()
+	void Hinge::Serialize(StreamIO* stream)
 	{
-		StreamIO::WriteBool(m_isConnected);
+		stream->WriteBool(m_isConnected);
 		if (m_isConnected)
 		{
 			if (!m_connectedGameObject.expired())
 			{
-				StreamIO::WriteInt(m_connectedGameObject._Get()->GetID());
+				stream->WriteInt(m_connectedGameObject._Get()->GetID());
 			}
 		}
 
-		StreamIO::WriteVector3(m_axisA);
-		StreamIO::WriteVector3(m_axisB);
-		StreamIO::WriteVector3(m_pivotA);
-		StreamIO::WriteVector3(m_pivotB);
+		stream->WriteVector3(m_axisA);
+		stream->WriteVector3(m_axisB);
+		stream->WriteVector3(m_pivotA);
+		stream->WriteVector3(m_pivotB);
 	}
 
-	void Hinge::Deserialize()
+	void Hinge::Deserialize(StreamIO* stream)
 	{
-		m_isConnected = StreamIO::ReadBool();
+		m_isConnected = stream->ReadBool();
 		if (m_isConnected)
 		{
 			// load gameobject
-			std::size_t gameObjectID = StreamIO::ReadInt();
+			std::size_t gameObjectID = stream->ReadInt();
 			m_connectedGameObject = g_context->GetSubsystem<Scene>()->GetGameObjectByID(gameObjectID);
 		}
 
-		m_axisA = StreamIO::ReadVector3();
-		m_axisB = StreamIO::ReadVector3();
-		m_pivotA = StreamIO::ReadVector3();
-		m_pivotB = StreamIO::ReadVector3();
+		m_axisA = stream->ReadVector3();
+		m_axisB = stream->ReadVector3();
+		m_pivotA = stream->ReadVector3();
+		m_pivotB = stream->ReadVector3();
 
 		m_isDirty = true;
 	}
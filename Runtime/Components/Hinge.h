@@ -46,8 +46,8 @@ namespace Directus
 		virtual void OnDisable();
 		virtual void Remove();
 		virtual void Update();
-		virtual void Serialize();
-		virtual void Deserialize();
+		virtual void Serialize(StreamIO* stream);
+		virtual void Deserialize(StreamIO* stream);
 
 		void SetConnectedGameObject(std::weak_ptr<GameObject> connectedRigidBody);
 		std::weak_ptr<GameObject> GetConnectedGameObject();
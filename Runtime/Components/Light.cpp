@@ -53,6 +53,7 @@ namespace Directus
 		m_cascades = 3;
 		m_frustrum = make_shared<Frustrum>();
 		m_isDirty = true;
+		m_lastKnownTransformVersion = 0;
 	}
 
 	Light::~Light()
@@ -95,9 +96,9 @@ namespace Directus
 			return;
 
 		// DIRTY CHECK
-		if (m_lastKnownRotation != g_transform->GetRotation())
+		if (m_lastKnownTransformVersion != g_transform->GetVersion())
 		{
-			m_lastKnownRotation = g_transform->GetRotation();
+			m_lastKnownTransformVersion = g_transform->GetVersion();
 			m_isDirty = true;
 		}
 
@@ -113,26 +114,26 @@ namespace Directus
 		m_frustrum->Construct(ComputeViewMatrix(), ComputeOrthographicProjectionMatrix(2), mainCamera->GetFarPlane());
 	}
 
-	void Light::Serialize()
+	void Light::Serialize(StreamIO* stream)
 	{
-		StreamIO::WriteInt(int(m_lightType));
-		StreamIO::WriteInt(int(m_shadowType));
-		StreamIO::WriteVector4(m_color);
-		StreamIO::WriteFloat(m_range);
-		StreamIO::WriteFloat(m_intensity);
-		StreamIO::WriteFloat(m_angle);
-		StreamIO::WriteFloat(m_bias);
+		stream->WriteInt(int(m_lightType));
+		stream->WriteInt(int(m_shadowType));
+		stream->WriteVector4(m_color);
+		stream->WriteFloat(m_range);
+		stream->WriteFloat(m_intensity);
+		stream->WriteFloat(m_angle);
+		stream->WriteFloat(m_bias);
 	}
 
-	void Light::Deserialize()
+	void Light::Deserialize(StreamIO* stream)
 	{
-		m_lightType = LightType(StreamIO::ReadInt());
-		m_shadowType = ShadowType(StreamIO::ReadInt());
-		m_color = StreamIO::ReadVector4();
-		m_range = StreamIO::ReadFloat();
-		m_intensity = StreamIO::ReadFloat();
-		m_angle = StreamIO::ReadFloat();
-		m_bias = StreamIO::ReadFloat();
+		m_lightType = LightType(stream->ReadInt());
+		m_shadowType = ShadowType(stream->ReadInt());
+		m_color = stream->ReadVector4();
+		m_range = stream->ReadFloat();
+		m_intensity = stream->ReadFloat();
+		m_angle = stream->ReadFloat();
+		m_bias = stream->ReadFloat();
 	}
 
 	void Light::SetLightType(LightType type)
@@ -231,10 +232,12 @@ namespace Directus
 
 	bool Light::IsInViewFrustrum(MeshFilter* meshFilter)
 	{
-		BoundingBox box = meshFilter->GetBoundingBoxTransformed();
-		Vector3 center = box.GetCenter();
-		Vector3 extents = box.GetHalfSize();
+		// Cheap sphere test first, the box is only needed when the sphere crosses a plane
+		const BoundingSphere& sphere = meshFilter->GetBoundingSphereTransformed();
+		Intersection result = m_frustrum->CheckSphere(sphere.center, sphere.radius);
+		if (result != Intersects)
+			return result == Inside;
 
-		return m_frustrum->CheckCube(center, extents) != Outside;
+		return m_frustrum->CheckOrientedBox(meshFilter->GetOrientedBoundingBox()) != Outside;
 	}
 }
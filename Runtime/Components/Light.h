@@ -68,8 +68,8 @@ namespace Directus
 		virtual void OnDisable();
 		virtual void Remove();
 		virtual void Update();
-		virtual void Serialize();
-		virtual void Deserialize();
+		virtual void Serialize(StreamIO* stream);
+		virtual void Deserialize(StreamIO* stream);
 
 		LightType GetLightType() { return m_lightType; }
 		void SetLightType(LightType type);
@@ -121,7 +121,7 @@ namespace Directus
 		std::shared_ptr<Math::Frustrum> m_frustrum;
 		int m_cascades;
 		std::vector<std::shared_ptr<Cascade>> m_shadowMaps;
-		Math::Quaternion m_lastKnownRotation;
+		unsigned int m_lastKnownTransformVersion;
 		bool m_isDirty;
 	};
 }
\ No newline at end of file
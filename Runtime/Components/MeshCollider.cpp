@@ -80,16 +80,16 @@ namespace Directus
 
 	}
 
-	void MeshCollider::Serialize()
+	void MeshCollider::Serialize(StreamIO* stream)
 	{
-		StreamIO::WriteBool(m_isConvex);
-		StreamIO::WriteUnsignedInt(!m_mesh.expired() ? m_mesh.lock()->GetID() : NOT_ASSIGNED_HASH);
+		stream->WriteBool(m_isConvex);
+		stream->WriteUnsignedInt(!m_mesh.expired() ? m_mesh.lock()->GetID() : NOT_ASSIGNED_HASH);
 	}
 
-	void MeshCollider::Deserialize()
+	void MeshCollider::Deserialize(StreamIO* stream)
 	{
-		m_isConvex = StreamIO::ReadBool();
-		unsigned int meshID = StreamIO::ReadUnsignedInt();
+		m_isConvex = stream->ReadBool();
+		unsigned int meshID = stream->ReadUnsignedInt();
 
 		auto models = g_context->GetSubsystem<ResourceManager>()->GetResourcesByType<Model>();
 		for (const auto& model : models)
@@ -120,20 +120,22 @@ namespace Directus
 		//= contruct collider ========================================================================================
 		btTriangleMesh* trimesh = new btTriangleMesh();
 		vector<Vector3> vertices;
+		const VertexPosTexTBN* meshVertices = m_mesh.lock()->GetVertexData();
+		const unsigned int* meshIndices = m_mesh.lock()->GetIndexData();
 		for (unsigned int i = 0; i < m_mesh.lock()->GetTriangleCount(); i++)
 		{
 
-			int index0 = m_mesh.lock()->GetIndices()[i * 3];
-			int index1 = m_mesh.lock()->GetIndices()[i * 3 + 1];
-			int index2 = m_mesh.lock()->GetIndices()[i * 3 + 2];
+			int index0 = meshIndices[i * 3];
+			int index1 = meshIndices[i * 3 + 1];
+			int index2 = meshIndices[i * 3 + 2];
 
-			vertices.push_back(m_mesh.lock()->GetVertices()[index0].position);
-			vertices.push_back(m_mesh.lock()->GetVertices()[index0].position);
-			vertices.push_back(m_mesh.lock()->GetVertices()[index0].position);
+			vertices.push_back(meshVertices[index0].position);
+			vertices.push_back(meshVertices[index0].position);
+			vertices.push_back(meshVertices[index0].position);
 
-			btVector3 vertex0 = ToBtVector3(m_mesh.lock()->GetVertices()[index0].position);
-			btVector3 vertex1 = ToBtVector3(m_mesh.lock()->GetVertices()[index1].position);
-			btVector3 vertex2 = ToBtVector3(m_mesh.lock()->GetVertices()[index2].position);
+			btVector3 vertex0 = ToBtVector3(meshVertices[index0].position);
+			btVector3 vertex1 = ToBtVector3(meshVertices[index1].position);
+			btVector3 vertex2 = ToBtVector3(meshVertices[index2].position);
 
 			trimesh->addTriangle(vertex0, vertex1, vertex2);
 		}
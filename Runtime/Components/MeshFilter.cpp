@@ -30,6 +30,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Math/Vector3.h"
 #include "../Graphics/Model.h"
 #include "../Graphics/Mesh.h"
+#include "../Graphics/MeshBVH.h"
 #include "../Graphics/D3D11/D3D11VertexBuffer.h"
 #include "../Graphics/D3D11/D3D11IndexBuffer.h"
 //==============================================
@@ -46,12 +47,18 @@ namespace Directus
 		g_typeStr = "MeshFilter";
 		m_meshType = Imported;
 		m_boundingBox = BoundingBox();
+		m_boundingBoxTransformedVersion = 0;
+		m_memoryUsageGPU = 0;
 	}
 
 	MeshFilter::~MeshFilter()
 	{
-		m_vertexBuffer.reset();
-		m_indexBuffer.reset();
+		if (!m_mesh.expired())
+		{
+			m_mesh._Get()->UnsubscribeFromUpdate(this);
+		}
+
+		ReleaseBuffers();
 	}
 
 	void MeshFilter::Reset()
@@ -79,20 +86,20 @@ namespace Directus
 
 	}
 
-	void MeshFilter::Serialize()
+	void MeshFilter::Serialize(StreamIO* stream)
 	{
-		StreamIO::WriteInt((int)m_meshType);
-		StreamIO::WriteSTR(!m_mesh.expired() ? m_mesh._Get()->GetName() : (string)NOT_ASSIGNED);
-		StreamIO::WriteUnsignedInt(!m_mesh.expired() ? m_mesh._Get()->GetID() : NOT_ASSIGNED_HASH);
-		StreamIO::WriteUnsignedInt(!m_mesh.expired() ? m_mesh._Get()->GetModelID() : NOT_ASSIGNED_HASH);
+		stream->WriteInt((int)m_meshType);
+		stream->WriteSTR(!m_mesh.expired() ? m_mesh._Get()->GetName() : (string)NOT_ASSIGNED);
+		stream->WriteUnsignedInt(!m_mesh.expired() ? m_mesh._Get()->GetID() : NOT_ASSIGNED_HASH);
+		stream->WriteUnsignedInt(!m_mesh.expired() ? m_mesh._Get()->GetModelID() : NOT_ASSIGNED_HASH);
 	}
 
-	void MeshFilter::Deserialize()
+	void MeshFilter::Deserialize(StreamIO* stream)
 	{
-		m_meshType = (MeshType)StreamIO::ReadInt();
-		string meshName = StreamIO::ReadSTR();
-		unsigned int meshID = StreamIO::ReadUnsignedInt();
-		unsigned int modelID = StreamIO::ReadUnsignedInt();
+		m_meshType = (MeshType)stream->ReadInt();
+		string meshName = stream->ReadSTR();
+		unsigned int meshID = stream->ReadUnsignedInt();
+		unsigned int modelID = stream->ReadUnsignedInt();
 
 		// If the mesh is an engine constructed primitive
 		if (m_meshType != Imported)
@@ -124,7 +131,15 @@ namespace Directus
 	// Sets a mesh from memory
 	bool MeshFilter::SetMesh(weak_ptr<Mesh> mesh)
 	{
+		if (!m_mesh.expired())
+		{
+			m_mesh._Get()->UnsubscribeFromUpdate(this);
+		}
+
+		// The buffers of the previous mesh count towards its model
+		ReleaseBuffers();
 		m_mesh = mesh;
+		m_boundingBoxTransformedVersion = 0;
 
 		if (m_mesh.expired())
 		{
@@ -134,7 +149,7 @@ namespace Directus
 		}
 
 		// Re-create the buffers whenever the mesh updates
-		m_mesh._Get()->SubscribeToUpdate(bind(&MeshFilter::CreateBuffers, this));
+		m_mesh._Get()->SubscribeToUpdate(this, bind(&MeshFilter::CreateBuffers, this));
 
 		CreateBuffers();
 
@@ -208,9 +223,44 @@ namespace Directus
 		return m_boundingBox;
 	}
 
-	BoundingBox MeshFilter::GetBoundingBoxTransformed()
+	BoundingSphere MeshFilter::GetBoundingSphere()
+	{
+		return !m_mesh.expired() ? m_mesh._Get()->GetBoundingSphere() : BoundingSphere();
+	}
+
+	const BoundingBox& MeshFilter::GetBoundingBoxTransformed()
 	{
-		return m_boundingBox.Transformed(g_transform->GetWorldTransform());
+		UpdateTransformedBounds();
+		return m_boundingBoxTransformed;
+	}
+
+	const BoundingSphere& MeshFilter::GetBoundingSphereTransformed()
+	{
+		UpdateTransformedBounds();
+		return m_boundingSphereTransformed;
+	}
+
+	const OrientedBoundingBox& MeshFilter::GetOrientedBoundingBox()
+	{
+		UpdateTransformedBounds();
+		return m_orientedBoundingBox;
+	}
+
+	float MeshFilter::HitDistance(const Ray& ray)
+	{
+		if (m_mesh.expired())
+			return INFINITY;
+
+		// Test in mesh space, so that the hierarchy can be built once and reused
+		const Matrix& worldInverted = g_transform->GetWorldTransformInverted();
+		Ray rayLocal(worldInverted * ray.GetOrigin(), worldInverted * ray.GetEnd());
+		float distanceLocal = m_mesh._Get()->GetBVH()->HitDistance(rayLocal);
+		if (distanceLocal == INFINITY)
+			return INFINITY;
+
+		// Scaling changes distances, so measure the hit point back in world space
+		Vector3 hitPoint = g_transform->GetWorldTransform() * (rayLocal.GetOrigin() + rayLocal.GetDirection() * distanceLocal);
+		return Vector3::Length(ray.GetOrigin(), hitPoint);
 	}
 
 	string MeshFilter::GetMeshName()
@@ -218,6 +268,12 @@ namespace Directus
 		return !m_mesh.expired() ? m_mesh._Get()->GetName() : NOT_ASSIGNED;
 	}
 
+	size_t MeshFilter::GetMemoryUsageGPU()
+	{
+		size_t size = m_vertexBuffer ? m_vertexBuffer->GetMemoryUsage() : 0;
+		return m_indexBuffer ? size + m_indexBuffer->GetMemoryUsage() : size;
+	}
+
 	bool MeshFilter::CreateBuffers()
 	{
 		auto graphicsDevice = g_context->GetSubsystem<Graphics>();
@@ -233,26 +289,44 @@ namespace Directus
 			return false;
 		}
 
-		m_vertexBuffer.reset();
-		m_indexBuffer.reset();
+		ReleaseBuffers();
 
-		m_vertexBuffer = make_shared<D3D11VertexBuffer>(graphicsDevice);
-		if (!m_vertexBuffer->Create(m_mesh._Get()->GetVertices()))
+		auto vertexBuffer = make_shared<D3D11VertexBuffer>(graphicsDevice);
+		if (!vertexBuffer->Create(m_mesh._Get()->GetVertexData(), m_mesh._Get()->GetVertexCount()))
 		{
 			LOG_ERROR("MeshFilter: Failed to create vertex buffer \"" + GetGameObjectName() + "\".");
 			return false;
 		}
 
-		m_indexBuffer = make_shared<D3D11IndexBuffer>(graphicsDevice);
-		if (!m_indexBuffer->Create(m_mesh._Get()->GetIndices()))
+		auto indexBuffer = make_shared<D3D11IndexBuffer>(graphicsDevice);
+		if (!indexBuffer->Create(m_mesh._Get()->GetIndexData(), m_mesh._Get()->GetIndexCount()))
 		{
 			LOG_ERROR("MeshFilter: Failed to create index buffer \"" + GetGameObjectName() + "\".");
 			return false;
 		}
 
+		m_vertexBuffer = vertexBuffer;
+		m_indexBuffer = indexBuffer;
+
+		// Account for the buffers in the model's memory usage
+		m_memoryUsageGPU = GetMemoryUsageGPU();
+		m_mesh._Get()->AddMemoryUsageGPU(m_memoryUsageGPU);
+
 		return true;
 	}
 
+	void MeshFilter::ReleaseBuffers()
+	{
+		if (!m_mesh.expired())
+		{
+			m_mesh._Get()->RemoveMemoryUsageGPU(m_memoryUsageGPU);
+		}
+		m_memoryUsageGPU = 0;
+
+		m_vertexBuffer.reset();
+		m_indexBuffer.reset();
+	}
+
 	void MeshFilter::CreateCube(vector<VertexPosTexTBN>& vertices, vector<unsigned int>& indices)
 	{
 		// front
@@ -335,4 +409,17 @@ namespace Directus
 	{
 		return !g_gameObject.expired() ? g_gameObject._Get()->GetName() : NOT_ASSIGNED;
 	}
+
+	void MeshFilter::UpdateTransformedBounds()
+	{
+		// Only re-compute when the transform has changed
+		if (m_boundingBoxTransformedVersion == g_transform->GetVersion())
+			return;
+
+		const Matrix& world = g_transform->GetWorldTransform();
+		m_boundingBoxTransformed = m_boundingBox.Transformed(world);
+		m_boundingSphereTransformed = GetBoundingSphere().Transformed(world);
+		m_orientedBoundingBox = OrientedBoundingBox(m_boundingBox, world);
+		m_boundingBoxTransformedVersion = g_transform->GetVersion();
+	}
 }
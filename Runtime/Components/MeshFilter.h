@@ -27,6 +27,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <memory>
 #include "../FileSystem/FileSystem.h"
 #include "../Math/BoundingBox.h"
+#include "../Math/BoundingSphere.h"
+#include "../Math/OrientedBoundingBox.h"
+#include "../Math/Ray.h"
 #include "../Graphics/Vertex.h"
 
 //===================================
@@ -57,8 +60,8 @@ namespace Directus
 		virtual void OnDisable();
 		virtual void Remove();
 		virtual void Update();
-		virtual void Serialize();
-		virtual void Deserialize();
+		virtual void Serialize(StreamIO* stream);
+		virtual void Deserialize(StreamIO* stream);
 		//=========================
 
 		// Sets a mesh from memory
@@ -70,27 +73,42 @@ namespace Directus
 		// Sets the meshe's buffers
 		bool SetBuffers();
 
-		//= BOUNDING BOX =============================
+		//= BOUNDING VOLUMES ===========================================
 		Math::BoundingBox GetBoundingBox();
-		Math::BoundingBox GetBoundingBoxTransformed();
-		//============================================
+		const Math::BoundingBox& GetBoundingBoxTransformed();
+		Math::BoundingSphere GetBoundingSphere();
+		const Math::BoundingSphere& GetBoundingSphereTransformed();
+		// World space box which follows the rotation, much tighter for long rotated meshes
+		const Math::OrientedBoundingBox& GetOrientedBoundingBox();
+		// Returns the world space distance to the nearest triangle hit, or infinity if there is no hit
+		float HitDistance(const Math::Ray& ray);
+		//==============================================================
 
 		//= PROPERTIES ===========================================
 		std::string GetMeshName();
 		const std::weak_ptr<Mesh>& GetMesh() { return m_mesh; }
 		bool HasMesh() { return m_mesh.expired() ? false : true; }
+		// Video memory used by the vertex and index buffers
+		size_t GetMemoryUsageGPU();
 		//========================================================
 
 	private:
 		bool CreateBuffers();
+		void ReleaseBuffers();
 		static void CreateCube(std::vector<VertexPosTexTBN>& vertices, std::vector<unsigned int>& indices);
 		static void CreateQuad(std::vector<VertexPosTexTBN>& vertices, std::vector<unsigned int>& indices);
 		std::string GetGameObjectName();
+		void UpdateTransformedBounds();
 
 		std::shared_ptr<D3D11VertexBuffer> m_vertexBuffer;
 		std::shared_ptr<D3D11IndexBuffer> m_indexBuffer;
+		size_t m_memoryUsageGPU; // added to the mesh, removed when the buffers are released
 		std::weak_ptr<Mesh> m_mesh;
 		MeshType m_meshType;
 		Math::BoundingBox m_boundingBox;
+		Math::BoundingBox m_boundingBoxTransformed;
+		Math::BoundingSphere m_boundingSphereTransformed;
+		Math::OrientedBoundingBox m_orientedBoundingBox;
+		unsigned int m_boundingBoxTransformedVersion; // transform version they were computed for
 	};
 }
\ No newline at end of file
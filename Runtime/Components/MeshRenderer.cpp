@@ -76,20 +76,20 @@ namespace Directus
 
 	}
 
-	void MeshRenderer::Serialize()
+	void MeshRenderer::Serialize(StreamIO* stream)
 	{
-		StreamIO::WriteInt((int)m_materialType);
-		StreamIO::WriteSTR(!m_material.expired() ? m_material._Get()->GetResourceFilePath() : (string)NOT_ASSIGNED);
-		StreamIO::WriteBool(m_castShadows);
-		StreamIO::WriteBool(m_receiveShadows);
+		stream->WriteInt((int)m_materialType);
+		stream->WriteSTR(!m_material.expired() ? m_material._Get()->GetResourceFilePath() : (string)NOT_ASSIGNED);
+		stream->WriteBool(m_castShadows);
+		stream->WriteBool(m_receiveShadows);
 	}
 
-	void MeshRenderer::Deserialize()
+	void MeshRenderer::Deserialize(StreamIO* stream)
 	{
-		m_materialType = (MaterialType)StreamIO::ReadInt();
-		string materialFilePath = StreamIO::ReadSTR();
-		m_castShadows = StreamIO::ReadBool();
-		m_receiveShadows = StreamIO::ReadBool();
+		m_materialType = (MaterialType)stream->ReadInt();
+		string materialFilePath = stream->ReadSTR();
+		m_castShadows = stream->ReadBool();
+		m_receiveShadows = stream->ReadBool();
 
 		// The Skybox material and texture is managed by the skybox component.
 		// No need to load anything as it will overwrite what the skybox component did.
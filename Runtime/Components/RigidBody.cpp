@@ -68,9 +68,20 @@ namespace Directus
 		void btMotionState::setWorldTransform(const btTransform& worldTransform) override
 		{
 			Quaternion bulletRot = ToQuaternion(worldTransform.getRotation());
-			Vector3 bulletPos = ToVector3(worldTransform.getOrigin()) - bulletRot * m_rigidBody->GetColliderCenter();
-			m_rigidBody->g_transform->SetPosition(bulletPos);
-			m_rigidBody->g_transform->SetRotation(bulletRot);
+
+			// While stepping, let the physics engine apply all the transforms in one go
+			Physics* physics = m_rigidBody->g_context->GetSubsystem<Physics>();
+			if (physics->IsSimulating())
+			{
+				TransformWrite write(m_rigidBody->g_transform, ToVector3(worldTransform.getOrigin()), bulletRot, m_rigidBody->g_transform->GetScale());
+				physics->QueueTransformWrite(write, m_rigidBody->GetColliderCenter());
+			}
+			else
+			{
+				Vector3 bulletPos = ToVector3(worldTransform.getOrigin()) - bulletRot * m_rigidBody->GetColliderCenter();
+				m_rigidBody->g_transform->SetPosition(bulletPos);
+				m_rigidBody->g_transform->SetRotation(bulletRot);
+			}
 
 			m_rigidBody->m_hasSimulated = true;
 		}
@@ -138,30 +149,30 @@ namespace Directus
 		}
 	}
 
-	void RigidBody::Serialize()
+	void RigidBody::Serialize(StreamIO* stream)
 	{
-		StreamIO::WriteFloat(m_mass);
-		StreamIO::WriteFloat(m_drag);
-		StreamIO::WriteFloat(m_angularDrag);
-		StreamIO::WriteFloat(m_restitution);
-		StreamIO::WriteBool(m_useGravity);
-		StreamIO::WriteVector3(m_gravity);
-		StreamIO::WriteBool(m_isKinematic);
-		StreamIO::WriteVector3(m_positionLock);
-		StreamIO::WriteVector3(m_rotationLock);
+		stream->WriteFloat(m_mass);
+		stream->WriteFloat(m_drag);
+		stream->WriteFloat(m_angularDrag);
+		stream->WriteFloat(m_restitution);
+		stream->WriteBool(m_useGravity);
+		stream->WriteVector3(m_gravity);
+		stream->WriteBool(m_isKinematic);
+		stream->WriteVector3(m_positionLock);
+		stream->WriteVector3(m_rotationLock);
 	}
 
-	void RigidBody::Deserialize()
+	void RigidBody::Deserialize(StreamIO* stream)
 	{
-		m_mass = StreamIO::ReadFloat();
-		m_drag = StreamIO::ReadFloat();
-		m_angularDrag = StreamIO::ReadFloat();
-		m_restitution = StreamIO::ReadFloat();
-		m_useGravity = StreamIO::ReadBool();
-		m_gravity = StreamIO::ReadVector3();
-		m_isKinematic = StreamIO::ReadBool();
-		m_positionLock = StreamIO::ReadVector3();
-		m_rotationLock = StreamIO::ReadVector3();
+		m_mass = stream->ReadFloat();
+		m_drag = stream->ReadFloat();
+		m_angularDrag = stream->ReadFloat();
+		m_restitution = stream->ReadFloat();
+		m_useGravity = stream->ReadBool();
+		m_gravity = stream->ReadVector3();
+		m_isKinematic = stream->ReadBool();
+		m_positionLock = stream->ReadVector3();
+		m_rotationLock = stream->ReadVector3();
 
 		AddBodyToWorld();
 	}
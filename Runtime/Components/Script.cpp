@@ -80,14 +80,14 @@ namespace Directus
 		m_scriptInstance->ExecuteUpdate();
 	}
 
-	void Script::Serialize()
+	void Script::Serialize(StreamIO* stream)
 	{
-		StreamIO::WriteSTR(m_scriptInstance ? m_scriptInstance->GetScriptPath() : (string)NOT_ASSIGNED);
+		stream->WriteSTR(m_scriptInstance ? m_scriptInstance->GetScriptPath() : (string)NOT_ASSIGNED);
 	}
 
-	void Script::Deserialize()
+	void Script::Deserialize(StreamIO* stream)
 	{
-		string scriptPath = StreamIO::ReadSTR();
+		string scriptPath = stream->ReadSTR();
 
 		if (scriptPath != NOT_ASSIGNED)
 		{
@@ -116,12 +116,12 @@ namespace Directus
 		g_transform->SetPosition(m_anchorTrans->GetPosition());
 	}
 
-	void Skybox::Serialize()
+	void Skybox::Serialize(StreamIO* stream)
 	{
 
 	}
 
-	void Skybox::Deserialize()
+	void Skybox::Deserialize(StreamIO* stream)
 	{
 
 	}
@@ -26,6 +26,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Core/GameObject.h"
 #include "../Logging/Log.h"
 #include "../FileSystem/FileSystem.h"
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
 //===================================
 
 //= NAMESPACES ================
@@ -42,12 +45,31 @@ namespace Directus
 		m_scaleLocal = Vector3::One;
 		m_worldTransform = Matrix::Identity;
 		m_localTransform = Matrix::Identity;
+		m_positionWorld = Vector3::Zero;
+		m_rotationWorld = Quaternion(0, 0, 0, 1);
+		m_scaleWorld = Vector3::One;
+		m_worldTransformInverted = Matrix::Identity;
+		m_isWorldDecompositionDirty = false;
+		m_isWorldInverseDirty = false;
+		m_version = 1;
 		m_parent = nullptr;
 	}
 
 	Transform::~Transform()
 	{
+		// Make the parent forget about this transform
+		if (m_parent)
+		{
+			m_parent->DetachChild(this);
+			m_parent = nullptr;
+		}
 
+		// Make sure no child keeps pointing to this transform
+		for (const auto& child : m_children)
+		{
+			child->m_parent = nullptr;
+		}
+		m_children.clear();
 	}
 
 	//= ICOMPONENT ====================================================================
@@ -76,22 +98,22 @@ namespace Directus
 
 	}
 
-	void Transform::Serialize()
+	void Transform::Serialize(StreamIO* stream)
 	{
-		StreamIO::WriteVector3(m_positionLocal);
-		StreamIO::WriteQuaternion(m_rotationLocal);
-		StreamIO::WriteVector3(m_scaleLocal);
-		StreamIO::WriteVector3(m_lookAt);
-		StreamIO::WriteUnsignedInt(m_parent ? m_parent->GetGameObject()._Get()->GetID() : NOT_ASSIGNED_HASH);
+		stream->WriteVector3(m_positionLocal);
+		stream->WriteQuaternion(m_rotationLocal);
+		stream->WriteVector3(m_scaleLocal);
+		stream->WriteVector3(m_lookAt);
+		stream->WriteUnsignedInt(m_parent ? m_parent->GetGameObject()._Get()->GetID() : NOT_ASSIGNED_HASH);
 	}
 
-	void Transform::Deserialize()
+	void Transform::Deserialize(StreamIO* stream)
 	{
-		m_positionLocal = StreamIO::ReadVector3();
-		m_rotationLocal = StreamIO::ReadQuaternion();
-		m_scaleLocal = StreamIO::ReadVector3();
-		m_lookAt = StreamIO::ReadVector3();
-		unsigned int parentGameObjectID = StreamIO::ReadUnsignedInt();
+		m_positionLocal = stream->ReadVector3();
+		m_rotationLocal = stream->ReadQuaternion();
+		m_scaleLocal = stream->ReadVector3();
+		m_lookAt = stream->ReadVector3();
+		unsigned int parentGameObjectID = stream->ReadUnsignedInt();
 
 		if (parentGameObjectID != NOT_ASSIGNED_HASH)
 		{
@@ -116,6 +138,13 @@ namespace Directus
 		// Calculate global transformation
 		m_worldTransform = HasParent() ? m_localTransform * GetParentTransformMatrix() : m_localTransform;
 
+		// The translation is free to extract, the rest is
+		// decomposed/inverted lazily, only when requested.
+		m_positionWorld = m_worldTransform.GetTranslation();
+		m_isWorldDecompositionDirty = true;
+		m_isWorldInverseDirty = true;
+		m_version++;
+
 		// update children
 		for (const auto& child : m_children)
 		{
@@ -126,7 +155,7 @@ namespace Directus
 	//= TRANSLATION ==================================================================================
 	void Transform::SetPosition(const Vector3& position)
 	{
-		SetPositionLocal(!HasParent() ? position : GetParent()->GetWorldTransform().Inverted() * position);
+		SetPositionLocal(!HasParent() ? position : GetParent()->GetWorldTransformInverted() * position);
 	}
 
 	void Transform::SetPositionLocal(const Vector3& position)
@@ -178,6 +207,150 @@ namespace Directus
 	}
 	//================================================================================================
 
+	//= BATCHING =====================================================================================
+	void Transform::SetWorldBatch(const vector<TransformWrite>& writes)
+	{
+		if (writes.empty())
+			return;
+
+		// Sort the writes by depth, so parents are always processed before their children
+		vector<pair<int, const TransformWrite*>> sorted;
+		sorted.reserve(writes.size());
+		for (const auto& write : writes)
+		{
+			if (!write.transform)
+				continue;
+
+			sorted.emplace_back(write.transform->GetDepth(), &write);
+		}
+		stable_sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+		// The new world matrix of every transform in the batch
+		unordered_map<Transform*, Matrix> newWorld;
+		newWorld.reserve(sorted.size());
+
+		//= ROTATIONS ===============================================================================
+		// Transforms whose ancestors aren't part of the batch convert their rotation using
+		// their parent's current one, so all of those conversions can be done in one go.
+		unordered_set<Transform*> batched;
+		batched.reserve(sorted.size());
+		for (const auto& entry : sorted)
+		{
+			batched.insert(entry.second->transform);
+		}
+
+		vector<char> isDirect(sorted.size(), 0);
+		vector<Quaternion> parentRotationsInverse, worldRotations;
+		for (size_t i = 0; i < sorted.size(); i++)
+		{
+			const TransformWrite& write = *sorted[i].second;
+			if (!write.transform->HasParent())
+				continue;
+
+			bool ancestorInBatch = false;
+			for (Transform* ancestor = write.transform->m_parent; ancestor && !ancestorInBatch; ancestor = ancestor->m_parent)
+			{
+				ancestorInBatch = batched.count(ancestor) != 0;
+			}
+
+			if (!ancestorInBatch)
+			{
+				isDirect[i] = 1;
+				parentRotationsInverse.push_back(write.transform->m_parent->GetRotation().Inverse());
+				worldRotations.push_back(write.rotation);
+			}
+		}
+
+		vector<Quaternion> localRotations(worldRotations.size());
+		Quaternion::MultiplyBatch(parentRotationsInverse.data(), worldRotations.data(), localRotations.data(), (int)localRotations.size());
+		size_t nextLocalRotation = 0;
+		//===========================================================================================
+
+		//= WORLD -> LOCAL ==========================================================================
+		for (size_t i = 0; i < sorted.size(); i++)
+		{
+			const TransformWrite& write = *sorted[i].second;
+			Transform* transform = write.transform;
+
+			// Compute what the parent's world matrix will be once the batch is applied.
+			// If none of the ancestors are part of the batch, it's simply the current one.
+			Matrix parentWorld = Matrix::Identity;
+			bool ancestorInBatch = false;
+			for (Transform* ancestor = transform->m_parent; ancestor; ancestor = ancestor->m_parent)
+			{
+				auto it = newWorld.find(ancestor);
+				if (it != newWorld.end())
+				{
+					parentWorld = parentWorld * it->second;
+					ancestorInBatch = true;
+					break;
+				}
+				parentWorld = parentWorld * ancestor->m_localTransform;
+			}
+
+			if (isDirect[i])
+			{
+				Transform* parent = transform->m_parent;
+				transform->m_positionLocal = parent->GetWorldTransformInverted() * write.position;
+				transform->m_rotationLocal = localRotations[nextLocalRotation++];
+				if (write.scale != transform->GetScale())
+				{
+					transform->m_scaleLocal = write.scale / parent->GetScale();
+				}
+			}
+			else if (transform->HasParent())
+			{
+				transform->m_positionLocal = parentWorld.Inverted() * write.position;
+				transform->m_rotationLocal = parentWorld.GetRotation().Inverse() * write.rotation;
+				if (write.scale != transform->GetScale())
+				{
+					transform->m_scaleLocal = write.scale / parentWorld.GetScale();
+				}
+			}
+			else
+			{
+				transform->m_positionLocal = write.position;
+				transform->m_rotationLocal = write.rotation;
+				transform->m_scaleLocal = write.scale;
+			}
+
+			// A scale of 0 will cause a division by zero when 
+			// decomposing the world transform matrix.
+			transform->m_scaleLocal.x = (transform->m_scaleLocal.x == 0.0f) ? M_EPSILON : transform->m_scaleLocal.x;
+			transform->m_scaleLocal.y = (transform->m_scaleLocal.y == 0.0f) ? M_EPSILON : transform->m_scaleLocal.y;
+			transform->m_scaleLocal.z = (transform->m_scaleLocal.z == 0.0f) ? M_EPSILON : transform->m_scaleLocal.z;
+
+			Matrix local = Matrix(transform->m_positionLocal, transform->m_rotationLocal, transform->m_scaleLocal);
+			newWorld[transform] = transform->HasParent() ? local * parentWorld : local;
+		}
+		//===========================================================================================
+
+		//= PROPAGATION =============================================================================
+		// Only the topmost transforms of the batch have to be updated,
+		// the update will reach any batched descendants on its way down.
+		for (const auto& entry : sorted)
+		{
+			Transform* transform = entry.second->transform;
+
+			bool ancestorInBatch = false;
+			for (Transform* ancestor = transform->m_parent; ancestor; ancestor = ancestor->m_parent)
+			{
+				if (newWorld.find(ancestor) != newWorld.end())
+				{
+					ancestorInBatch = true;
+					break;
+				}
+			}
+
+			if (!ancestorInBatch)
+			{
+				transform->UpdateTransform();
+			}
+		}
+		//===========================================================================================
+	}
+	//================================================================================================
+
 	//= TRANSLATION/ROTATION =========================================================================
 	void Transform::Translate(const Vector3& delta)
 	{
@@ -187,7 +360,7 @@ namespace Directus
 		}
 		else
 		{
-			SetPositionLocal(m_positionLocal + GetParent()->GetWorldTransform().Inverted() * delta);
+			SetPositionLocal(m_positionLocal + GetParent()->GetWorldTransformInverted() * delta);
 		}
 	}
 
@@ -248,11 +421,14 @@ namespace Directus
 		// if the new parent is a descendant of this transform
 		if (newParent->IsDescendantOf(this))
 		{
+			// the children will be re-parented, so iterate over a copy
+			vector<Transform*> children = m_children;
+
 			// if this transform already has a parent
 			if (this->HasParent())
 			{
 				// assign the parent of this transform to the children
-				for (const auto& child : m_children)
+				for (const auto& child : children)
 				{
 					child->SetParent(GetParent());
 				}
@@ -260,28 +436,24 @@ namespace Directus
 			else // if this transform doesn't have a parent
 			{
 				// make the children orphans
-				for (const auto& child : m_children)
+				for (const auto& child : children)
 				{
 					child->BecomeOrphan();
 				}
 			}
 		}
 
-		// Make this transform an orphan, this will also cause the 
-		// parent to "forget" about this transform/child
+		// Make the current parent "forget" about this transform/child
 		if (HasParent())
 		{
-			m_parent->ResolveChildrenRecursively();
+			m_parent->DetachChild(this);
 		}
 
 		// save the new parent as the current parent
 		m_parent = newParent;
 
 		// make the new parent "aware" of this transform/child
-		if (m_parent)
-		{
-			m_parent->ResolveChildrenRecursively();
-		}
+		m_parent->AttachChild(this);
 
 		UpdateTransform();
 	}
@@ -328,47 +500,15 @@ namespace Directus
 		return nullptr;
 	}
 
-	// Searches the entiry hierarchy, finds any children and saves them in m_children.
-	// This is a recursive function, the children will also find their own children and so on...
-	void Transform::ResolveChildrenRecursively()
-	{
-		m_children.clear();
-		m_children.shrink_to_fit();
-
-		auto gameObjects = g_context->GetSubsystem<Scene>()->GetAllGameObjects();
-		for (const auto& gameObject : gameObjects)
-		{
-			if (!gameObject)
-				continue;
-
-			// get the possible child
-			Transform* possibleChild = gameObject->GetTransform();
-
-			// if it doesn't have a parent, forget about it.
-			if (!possibleChild->HasParent())
-				continue;
-
-			// if it's parent matches this transform
-			if (possibleChild->GetParent()->g_ID == g_ID)
-			{
-				// welcome home son
-				m_children.push_back(possibleChild);
-
-				// make the child do the same thing all over, essentialy
-				// resolving the entire hierarchy.
-				possibleChild->ResolveChildrenRecursively();
-			}
-		}
-	}
-
 	bool Transform::IsDescendantOf(Transform* transform)
 	{
-		vector<Transform*> descendants;
-		transform->GetDescendants(&descendants);
+		if (!transform)
+			return false;
 
-		for (const auto& descendant : descendants)
+		// Walk up the hierarchy, this only costs as much as the depth of this transform
+		for (Transform* ancestor = m_parent; ancestor; ancestor = ancestor->m_parent)
 		{
-			if (descendant->g_ID == g_ID)
+			if (ancestor->g_ID == transform->g_ID)
 				return true;
 		}
 
@@ -390,11 +530,61 @@ namespace Directus
 		return !g_gameObject.expired() ? g_gameObject._Get()->GetName() : NOT_ASSIGNED;
 	}
 
+	const Matrix& Transform::GetWorldTransformInverted()
+	{
+		if (m_isWorldInverseDirty)
+		{
+			m_worldTransformInverted = m_worldTransform.Inverted();
+			m_isWorldInverseDirty = false;
+		}
+
+		return m_worldTransformInverted;
+	}
+
+	void Transform::DecomposeWorldTransform()
+	{
+		if (!m_isWorldDecompositionDirty)
+			return;
+
+		m_scaleWorld = m_worldTransform.GetScale();
+		m_rotationWorld = m_worldTransform.GetRotation();
+		m_isWorldDecompositionDirty = false;
+	}
+
+	int Transform::GetDepth()
+	{
+		int depth = 0;
+		for (Transform* ancestor = m_parent; ancestor; ancestor = ancestor->m_parent)
+		{
+			depth++;
+		}
+
+		return depth;
+	}
+
 	Matrix Transform::GetParentTransformMatrix()
 	{
 		return HasParent() ? GetParent()->GetWorldTransform() : Matrix::Identity;
 	}
 
+	void Transform::AttachChild(Transform* child)
+	{
+		m_children.push_back(child);
+	}
+
+	void Transform::DetachChild(Transform* child)
+	{
+		// Search backwards, the most recently attached children are the most likely to leave
+		for (auto it = m_children.rbegin(); it != m_children.rend(); ++it)
+		{
+			if (*it == child)
+			{
+				m_children.erase(next(it).base());
+				return;
+			}
+		}
+	}
+
 	// Makes this transform have no parent
 	void Transform::BecomeOrphan()
 	{
@@ -402,21 +592,11 @@ namespace Directus
 		if (!m_parent)
 			return;
 
-		// create a temporary reference to the parent
-		Transform* tempRef = m_parent;
-
-		// delete the original reference
+		// make the parent "forget" about this child
+		m_parent->DetachChild(this);
 		m_parent = nullptr;
 
 		// Update the transform without the parent now
 		UpdateTransform();
-
-		// make the parent search for children,
-		// that's indirect way of making tha parent "forget"
-		// about this child, since it won't be able to find it
-		if (tempRef)
-		{
-			tempRef->ResolveChildrenRecursively();
-		}
 	}
 }
\ No newline at end of file
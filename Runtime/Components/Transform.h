@@ -33,6 +33,26 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 namespace Directus
 {
+	class Transform;
+
+	// A world space write, used to update many transforms at once
+	struct TransformWrite
+	{
+		TransformWrite() {}
+		TransformWrite(Transform* transform, const Math::Vector3& position, const Math::Quaternion& rotation, const Math::Vector3& scale)
+		{
+			this->transform = transform;
+			this->position = position;
+			this->rotation = rotation;
+			this->scale = scale;
+		}
+
+		Transform* transform = nullptr;
+		Math::Vector3 position;
+		Math::Quaternion rotation;
+		Math::Vector3 scale;
+	};
+
 	class DLL_API Transform : public Component
 	{
 	public:
@@ -45,29 +65,34 @@ namespace Directus
 		virtual void OnDisable();
 		virtual void Remove();
 		virtual void Update();
-		virtual void Serialize();
-		virtual void Deserialize();
+		virtual void Serialize(StreamIO* stream);
+		virtual void Deserialize(StreamIO* stream);
 
 		void UpdateTransform();
 
 		//= POSITION ======================================================================
-		Math::Vector3 GetPosition() { return m_worldTransform.GetTranslation(); }
+		Math::Vector3 GetPosition() { return m_positionWorld; }
 		const Math::Vector3& GetPositionLocal() { return m_positionLocal; }
 		void SetPosition(const Math::Vector3& position);
 		void SetPositionLocal(const Math::Vector3& position);
 
 		//= ROTATION ======================================================================
-		Math::Quaternion GetRotation() { return m_worldTransform.GetRotation(); }
+		Math::Quaternion GetRotation() { DecomposeWorldTransform(); return m_rotationWorld; }
 		const Math::Quaternion& GetRotationLocal() { return m_rotationLocal; }
 		void SetRotation(const Math::Quaternion& rotation);
 		void SetRotationLocal(const Math::Quaternion& rotation);
 
 		//= SCALE =========================================================================
-		Math::Vector3 GetScale() { return m_worldTransform.GetScale(); }
+		Math::Vector3 GetScale() { DecomposeWorldTransform(); return m_scaleWorld; }
 		const Math::Vector3& GetScaleLocal() { return m_scaleLocal; }
 		void SetScale(const Math::Vector3& scale);
 		void SetScaleLocal(const Math::Vector3& scale);
 
+		//= BATCHING ======================================================================
+		// Converts all the world space writes to local space and then updates
+		// the affected hierarchies once, instead of once per write.
+		static void SetWorldBatch(const std::vector<TransformWrite>& writes);
+
 		//= TRANSLATION/ROTATION =========================================================
 		void Translate(const Math::Vector3& delta);
 		void Rotate(const Math::Quaternion& delta);
@@ -91,14 +116,20 @@ namespace Directus
 		Transform* GetChildByName(const std::string& name);
 		const std::vector<Transform*>& GetChildren() { return m_children; }
 		int GetChildrenCount() { return (int)m_children.size(); }
-		void ResolveChildrenRecursively();
 		bool IsDescendantOf(Transform* transform);
 		void GetDescendants(std::vector<Transform*>* descendants);
 		std::string GetGameObjName();
 
+		//= CHANGE TRACKING ==============================================================
+		// Increases every time the world transform changes, dependents can
+		// compare it against the last value they saw to skip work in O(1).
+		// A value of 0 is never used, so it can mean "never seen".
+		unsigned int GetVersion() { return m_version; }
+
 		//= ICOMPONENT ====================================================================
 		void LookAt(const Math::Vector3& v) { m_lookAt = v; }
 		Math::Matrix& GetWorldTransform() { return m_worldTransform; }
+		const Math::Matrix& GetWorldTransformInverted();
 		Math::Matrix& GetLocalTransform() { return m_localTransform; }
 		weakGameObj& GetGameObject() { return g_gameObject; }		
 
@@ -112,10 +143,23 @@ namespace Directus
 		Math::Matrix m_localTransform;
 		Math::Vector3 m_lookAt;
 
+		// world (cached, derived from m_worldTransform)
+		Math::Vector3 m_positionWorld;
+		Math::Quaternion m_rotationWorld;
+		Math::Vector3 m_scaleWorld;
+		Math::Matrix m_worldTransformInverted;
+		bool m_isWorldDecompositionDirty;
+		bool m_isWorldInverseDirty;
+		unsigned int m_version;
+
 		Transform* m_parent; // the parent of this transform
 		std::vector<Transform*> m_children; // the children of this transform
 
 		//= HELPER FUNCTIONS ================================================================
 		Math::Matrix GetParentTransformMatrix();
+		void DecomposeWorldTransform();
+		int GetDepth();
+		void AttachChild(Transform* child);
+		void DetachChild(Transform* child);
 	};
 }
\ No newline at end of file
@@ -17,7 +17,7 @@ DEALINGS IN THE SOFTWARE. */
 #pragma once
 
 //= INCLUDES =========
-#include "Subsystem.h"
+#include "SubSystem.h"
 #include <vector>
 //====================
 
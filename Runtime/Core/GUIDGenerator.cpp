@@ -25,9 +25,13 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "GUIDGenerator.h"
 #include <iomanip>
 #include <sstream> 
+#ifdef _WIN32
 #include <guiddef.h>
 #include "Objbase.h"
 #include <winerror.h>
+#else
+#include <random>
+#endif
 //========================
 
 //= NAMESPACES =====
@@ -45,6 +49,7 @@ namespace Directus
 	string GUIDGenerator::GenerateAsStr()
 	{
 		string guidString = "N/A";
+#ifdef _WIN32
 		GUID guid;
 		HRESULT hr = CoCreateGuid(&guid);
 		if (SUCCEEDED(hr))
@@ -64,6 +69,22 @@ namespace Directus
 			}
 			guidString = stream.str();
 		}
+#else
+		// A random (version 4) GUID, for the tools that run on other platforms
+		random_device random;
+		unsigned int data[4] = { random(), random(), random(), random() };
+		data[1] = (data[1] & 0xFFFF0FFF) | 0x00004000;
+		data[2] = (data[2] & 0x3FFFFFFF) | 0x80000000;
+
+		stringstream stream;
+		stream << hex << uppercase << setfill('0')
+			<< setw(8) << data[0]
+			<< "-" << setw(4) << (data[1] >> 16)
+			<< "-" << setw(4) << (data[1] & 0xFFFF)
+			<< "-" << setw(4) << (data[2] >> 16)
+			<< "-" << setw(4) << (data[2] & 0xFFFF) << setw(8) << data[3];
+		guidString = stream.str();
+#endif
 
 		return guidString;
 	}
@@ -113,18 +113,17 @@ namespace Directus
 	bool GameObject::SaveAsPrefab(const string& filePath)
 	{
 		// Try to create a prefab file
-		if (!StreamIO::StartWriting(filePath + PREFAB_EXTENSION))
+		StreamIO stream(filePath + PREFAB_EXTENSION, Stream_Write);
+		if (!stream.IsOpen())
 			return false;
 
 		m_isPrefab = true;
 
 		// Serialize as usual...
-		Serialize();
+		Serialize(&stream);
 
 		// Close it
-		StreamIO::StopWriting();
-
-		return true;
+		return stream.Close();
 	}
 
 	bool GameObject::LoadFromPrefab(const string& filePath)
@@ -134,39 +133,43 @@ namespace Directus
 			return false;
 
 		// Try to open it
-		if (!StreamIO::StartReading(filePath))
+		StreamIO stream(filePath, Stream_Read);
+		if (!stream.IsOpen())
 			return false;
 
 		// Deserialize as usual...
-		Deserialize(nullptr);
+		Deserialize(&stream, nullptr);
 
-		// Close it
-		StreamIO::StopReading();
+		if (stream.HasError())
+		{
+			LOG_ERROR("Prefab \"" + filePath + "\" is corrupted.");
+			return false;
+		}
 
 		return true;
 	}
 
-	void GameObject::Serialize()
+	void GameObject::Serialize(StreamIO* stream)
 	{
 		//= BASIC DATA ================================
-		StreamIO::WriteBool(m_isPrefab);
-		StreamIO::WriteBool(m_isActive);
-		StreamIO::WriteBool(m_hierarchyVisibility);
-		StreamIO::WriteUnsignedInt(m_ID);
-		StreamIO::WriteSTR(m_name);		
+		stream->WriteBool(m_isPrefab);
+		stream->WriteBool(m_isActive);
+		stream->WriteBool(m_hierarchyVisibility);
+		stream->WriteUnsignedInt(m_ID);
+		stream->WriteSTR(m_name);		
 		//=============================================
 
 		//= COMPONENTS ================================
-		StreamIO::WriteInt((int)m_components.size());
+		stream->WriteInt((int)m_components.size());
 		for (const auto& component : m_components)
 		{
-			StreamIO::WriteSTR(component->g_typeStr);
-			StreamIO::WriteUnsignedInt(component->g_ID);
+			stream->WriteSTR(component->g_typeStr);
+			stream->WriteUnsignedInt(component->g_ID);
 		}
 
 		for (const auto& component : m_components)
 		{
-			component->Serialize();
+			component->Serialize(stream);
 		}
 		//=============================================
 
@@ -174,12 +177,12 @@ namespace Directus
 		vector<Transform*> children = GetTransform()->GetChildren();
 
 		// 1st - children count
-		StreamIO::WriteInt((int)children.size());
+		stream->WriteInt((int)children.size());
 
 		// 2nd - children IDs
 		for (const auto& child : children)
 		{
-			StreamIO::WriteUnsignedInt(child->g_ID);
+			stream->WriteUnsignedInt(child->g_ID);
 		}
 
 		// 3rd - children
@@ -187,7 +190,7 @@ namespace Directus
 		{
 			if (!child->g_gameObject.expired())
 			{
-				child->g_gameObject._Get()->Serialize();
+				child->g_gameObject._Get()->Serialize(stream);
 			}
 			else
 			{
@@ -198,24 +201,30 @@ namespace Directus
 		//=============================================
 	}
 
-	void GameObject::Deserialize(Transform* parent)
+	void GameObject::Deserialize(StreamIO* stream, Transform* parent)
 	{
 		//= BASIC DATA ================================
-		m_isPrefab = StreamIO::ReadBool();
-		m_isActive = StreamIO::ReadBool();
-		m_hierarchyVisibility = StreamIO::ReadBool();
-		m_ID = StreamIO::ReadUnsignedInt();
-		m_name = StreamIO::ReadSTR();
+		m_isPrefab = stream->ReadBool();
+		m_isActive = stream->ReadBool();
+		m_hierarchyVisibility = stream->ReadBool();
+		m_ID = stream->ReadUnsignedInt();
+		m_name = stream->ReadSTR();
 		//=============================================
 
 		//= COMPONENTS ================================
-		int componentCount = StreamIO::ReadInt();
+		int componentCount = stream->ReadInt();
 		for (int i = 0; i < componentCount; i++)
 		{
-			string type = StreamIO::ReadSTR(); // load component's type
-			unsigned int id = StreamIO::ReadUnsignedInt(); // load component's id
+			string type = stream->ReadSTR(); // load component's type
+			unsigned int id = stream->ReadUnsignedInt(); // load component's id
 
+			// Unknown types only come from corrupted data, stop there
 			Component* component = AddComponentBasedOnType(type);
+			if (!component)
+			{
+				LOG_ERROR("Aborting GameObject deserialization, unknown component type \"" + type + "\".");
+				return;
+			}
 			component->g_ID = id;
 		}
 		// Sometimes there are component dependencies, e.g. a collider that needs
@@ -223,7 +232,7 @@ namespace Directus
 		// the components (like above) and then deserialize them (like here).
 		for (const auto& component : m_components)
 		{
-			component->Deserialize();
+			component->Deserialize(stream);
 		}
 		//=============================================
 
@@ -235,7 +244,7 @@ namespace Directus
 
 		//= CHILDREN ===================================
 		// 1st - children count
-		int childrenCount = StreamIO::ReadInt();
+		int childrenCount = stream->ReadInt();
 
 		// 2nd - children IDs
 		auto scene = m_context->GetSubsystem<Scene>();
@@ -243,21 +252,16 @@ namespace Directus
 		for (int i = 0; i < childrenCount; i++)
 		{
 			weakGameObj child = scene->CreateGameObject();
-			child._Get()->SetID(StreamIO::ReadUnsignedInt());
+			child._Get()->SetID(stream->ReadUnsignedInt());
 			children.push_back(child);
 		}
 
 		// 3rd - children
 		for (const auto& child : children)
 		{
-			child._Get()->Deserialize(GetTransform());
+			child._Get()->Deserialize(stream, GetTransform());
 		}
 		//=============================================
-
-		if (m_transform)
-		{
-			m_transform->ResolveChildrenRecursively();
-		}
 	}
 
 	void GameObject::RemoveComponentByID(unsigned int id)
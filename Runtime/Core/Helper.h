@@ -21,10 +21,14 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #pragma once
 
-#ifdef COMPILING_LIB
-#define DLL_API __declspec(dllexport)
+#if defined(_MSC_VER)
+	#ifdef COMPILING_LIB
+	#define DLL_API __declspec(dllexport)
+	#else
+	#define DLL_API __declspec(dllimport)
+	#endif
 #else
-#define DLL_API __declspec(dllimport)
+	#define DLL_API
 #endif
 
 namespace Directus
@@ -140,12 +140,13 @@ namespace Directus
 		// Save any in-memory changes done to resources while running.
 		m_context->GetSubsystem<ResourceManager>()->SaveResourceMetadata();
 
-		if (!StreamIO::StartWriting(filePath))
+		StreamIO stream(filePath, Stream_Write);
+		if (!stream.IsOpen())
 			return false;
 
 		//= Save currently loaded resource paths =======================================================
 		vector<string> resourcePaths = m_context->GetSubsystem<ResourceManager>()->GetResourceFilePaths();
-		StreamIO::WriteVectorSTR(resourcePaths);
+		stream.WriteVectorSTR(resourcePaths);
 		//==============================================================================================
 
 		//= Save GameObjects ============================
@@ -154,26 +155,24 @@ namespace Directus
 
 		// 1st - GameObject count
 		int rootGameObjectCount = (int)rootGameObjects.size();
-		StreamIO::WriteInt(rootGameObjectCount);
+		stream.WriteInt(rootGameObjectCount);
 
 		// 2nd - GameObject IDs
 		for (const auto& root : rootGameObjects)
 		{
-			StreamIO::WriteInt(root._Get()->GetID());
+			stream.WriteInt(root._Get()->GetID());
 		}
 
 		// 3rd - GameObjects
 		for (const auto& root : rootGameObjects)
 		{
-			root._Get()->Serialize();
+			root._Get()->Serialize(&stream);
 		}
 		//==============================================
 
-		StreamIO::StopWriting();
-
 		ResetLoadingStats();
 
-		return true;
+		return stream.Close();
 	}
 
 	bool Scene::LoadFromFile(const string& filePath)
@@ -190,49 +189,45 @@ namespace Directus
 		Clear();
 
 		// Read all the resource file paths
-		if (!StreamIO::StartReading(filePath))
+		StreamIO stream(filePath, Stream_Read);
+		if (!stream.IsOpen())
 			return false;
 
-		vector<string> resourcePaths = StreamIO::ReadVectorSTR();
-		StreamIO::StopReading();
+		vector<string> resourcePaths = stream.ReadVectorSTR();
 
-		// Load all the resources
+		// Load all the resources, they decode in parallel on the worker threads
 		auto resourceMng = m_context->GetSubsystem<ResourceManager>();
 		for (const auto& resourcePath : resourcePaths)
 		{
 			if (FileSystem::IsEngineModelFile(resourcePath))
 			{
-				resourceMng->Load<Model>(resourcePath);
+				resourceMng->LoadAsync<Model>(resourcePath);
 				continue;
 			}
 
 			if (FileSystem::IsEngineMaterialFile(resourcePath))
 			{
-				resourceMng->Load<Material>(resourcePath);
+				resourceMng->LoadAsync<Material>(resourcePath);
 				continue;
 			}
 
 			if (FileSystem::IsSupportedImageFile(resourcePath))
 			{
-				resourceMng->Load<Texture>(resourcePath);
+				resourceMng->LoadAsync<Texture>(resourcePath);
 			}
 		}
+		resourceMng->WaitForAsyncLoads();
 
-		if (!StreamIO::StartReading(filePath))
-			return false;
-
-		// Read our way through the resource paths
-		StreamIO::ReadVectorSTR();
-
+		// The stream is still where we left it, right after the resource paths
 		//= Load GameObjects ============================	
 		// 1st - Root GameObject count
-		int rootGameObjectCount = StreamIO::ReadInt();
+		int rootGameObjectCount = stream.ReadInt();
 
 		// 2nd - Root GameObject IDs
 		for (int i = 0; i < rootGameObjectCount; i++)
 		{
 			auto gameObj = CreateGameObject().lock();
-			gameObj->SetID(StreamIO::ReadInt());
+			gameObj->SetID(stream.ReadInt());
 		}
 
 		// 3rd - GameObjects
@@ -242,12 +237,16 @@ namespace Directus
 		// deserialize their descendants.
 		for (int i = 0; i < rootGameObjectCount; i++)
 		{
-			m_gameObjects[i]->Deserialize(nullptr);
+			m_gameObjects[i]->Deserialize(&stream, nullptr);
 		}
 
-		StreamIO::StopReading();
 		//==============================================
 
+		if (stream.HasError())
+		{
+			LOG_ERROR("Scene: \"" + filePath + "\" is corrupted.");
+		}
+
 		Resolve();
 		ResetLoadingStats();
 
@@ -301,6 +300,47 @@ namespace Directus
 		return weakGameObj();
 	}
 
+	//= RAYCASTING =====================================================================
+	weakGameObj Scene::Raycast(const Ray& ray, float* hitDistance)
+	{
+		float hitDistanceMin = INFINITY;
+		weakGameObj nearestGameObj;
+
+		for (const auto& gameObj : m_renderables)
+		{
+			GameObject* gameObjPtr = gameObj._Get();
+			if (!gameObjPtr || gameObjPtr->HasComponent<Skybox>())
+				continue;
+
+			MeshFilter* meshFilter = gameObjPtr->GetMeshFilter();
+			if (!meshFilter || !meshFilter->HasMesh())
+				continue;
+
+			// Cheap rejections first, anything further than the nearest hit can't win
+			if (ray.HitDistance(meshFilter->GetBoundingSphereTransformed()) >= hitDistanceMin)
+				continue;
+
+			if (ray.HitDistance(meshFilter->GetOrientedBoundingBox()) >= hitDistanceMin)
+				continue;
+
+			// Exact test against the triangles
+			float distance = meshFilter->HitDistance(ray);
+			if (distance < hitDistanceMin)
+			{
+				hitDistanceMin = distance;
+				nearestGameObj = gameObj;
+			}
+		}
+
+		if (hitDistance)
+		{
+			*hitDistance = hitDistanceMin;
+		}
+
+		return nearestGameObj;
+	}
+	//==================================================================================
+
 	bool Scene::GameObjectExists(weakGameObj gameObject)
 	{
 		if (gameObject.expired())
@@ -323,15 +363,9 @@ namespace Directus
 			RemoveSingleGameObject(descendant->GetGameObject());
 		}
 
-		// remove this gameobject but keep it's parent
-		Transform* parent = gameObject._Get()->GetTransform()->GetParent();
+		// remove this gameobject but keep it's parent, the
+		// transform will detach itself from it when destroyed
 		RemoveSingleGameObject(gameObject);
-
-		// if there is a parent, update it's children pool
-		if (parent)
-		{
-			parent->ResolveChildrenRecursively();
-		}
 	}
 
 	// Removes a GameObject but leaves the parent and the children as is
@@ -24,6 +24,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 //= INCLUDES ======================
 #include <vector>
 #include "../Math/Vector3.h"
+#include "../Math/Ray.h"
 #include "../Threading/Threading.h"
 //=================================
 
@@ -72,6 +73,11 @@ namespace Directus
 		const std::vector<weakGameObj>& GetRenderables() { return m_renderables; }
 		weakGameObj GetMainCamera() { return m_mainCamera; }
 
+		//= RAYCASTING =====================================================================
+		// Returns the nearest renderable whose triangles the ray hits (no colliders needed)
+		weakGameObj Raycast(const Math::Ray& ray, float* hitDistance = nullptr);
+		//==================================================================================
+
 		//= MISC =======================================
 		void SetAmbientLight(float x, float y, float z);
 		Math::Vector3 GetAmbientLight();
@@ -22,6 +22,8 @@ DEALINGS IN THE SOFTWARE. */
 
 namespace Directus
 {
+	class Context;
+
 	class DLL_API Subsystem
 	{
 		friend class Context;
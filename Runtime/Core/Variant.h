@@ -341,6 +341,6 @@ namespace Directus
 		T* ptr = (T*)variant.GetVectorRef().ptr;
 		int length = variant.GetVectorRef().length;
 
-		return vector<T>(ptr, ptr + length);
+		return std::vector<T>(ptr, ptr + length);
 	}
 }
@@ -0,0 +1,356 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+//= INCLUDES ====================
+#include "AssetArchive.h"
+#include <fstream>
+#include <algorithm>
+#include <unordered_map>
+#include <mutex>
+#include <cstring>
+#include "FileSystem.h"
+#include "MappedFile.h"
+#include "../Logging/Log.h"
+#define FREEIMAGE_LIB
+#include "FreeImage.h"
+//===============================
+
+//= NAMESPACES =====
+using namespace std;
+//==================
+
+#define ARCHIVE_MAGIC "DPAK"
+#define ARCHIVE_VERSION 1
+#define ARCHIVE_ALIGNMENT 16
+#define ARCHIVE_COMPRESSED 1
+
+namespace Directus
+{
+	struct ArchiveHeader
+	{
+		char magic[4];
+		unsigned int version;
+		unsigned int entryCount;
+		unsigned int pathTableSize;
+		unsigned long long tocOffset;
+		unsigned long long reserved;
+	};
+
+	// Archives mounted later take precedence
+	static vector<shared_ptr<AssetArchive>> mountedArchives;
+	static mutex mountMutex;
+
+	AssetArchive::AssetArchive()
+	{
+		m_data = nullptr;
+		m_size = 0;
+	}
+
+	AssetArchive::~AssetArchive()
+	{
+		Close();
+	}
+
+	bool AssetArchive::Build(const string& archivePath, const vector<string>& filePaths, bool compress)
+	{
+		ofstream archive(archivePath, ios::out | ios::binary);
+		if (archive.fail())
+		{
+			LOG_ERROR("AssetArchive: Failed to create \"" + archivePath + "\".");
+			return false;
+		}
+
+		// The header is written last, once the table of contents is known
+		ArchiveHeader header = {};
+		archive.write(reinterpret_cast<char*>(&header), sizeof(header));
+
+		vector<Entry> entries;
+		vector<char> pathTable;
+		unordered_map<unsigned long long, string> hashedPaths;
+		vector<unsigned char> compressed;
+		for (const auto& filePath : filePaths)
+		{
+			string path = FileSystem::NormalizePath(filePath);
+			unsigned long long hash = HashPath(path);
+			auto hashed = hashedPaths.find(hash);
+			if (hashed != hashedPaths.end())
+			{
+				if (hashed->second == path)
+					continue;
+
+				LOG_ERROR("AssetArchive: \"" + path + "\" and \"" + hashed->second + "\" have the same hash, rename one of them.");
+				return false;
+			}
+			hashedPaths[hash] = path;
+
+			ifstream file(filePath, ios::in | ios::binary | ios::ate);
+			if (file.fail())
+			{
+				LOG_WARNING("AssetArchive: Failed to read \"" + filePath + "\", skipping it.");
+				continue;
+			}
+			vector<unsigned char> data((size_t)file.tellg());
+			file.seekg(0);
+			file.read(reinterpret_cast<char*>(data.data()), data.size());
+
+			Entry entry = {};
+			entry.pathHash = hash;
+			entry.size = data.size();
+			entry.storedSize = data.size();
+			entry.pathOffset = (unsigned int)pathTable.size();
+			pathTable.insert(pathTable.end(), path.begin(), path.end());
+			pathTable.push_back('\0');
+
+			// Compressed entries have to be decompressed into memory, so only keep the ones that are worth it
+			const unsigned char* blob = data.data();
+			if (compress && !data.empty())
+			{
+				compressed.resize(data.size() + data.size() / 100 + 64);
+				unsigned long long compressedSize = FreeImage_ZLibCompress(compressed.data(), (DWORD)compressed.size(), data.data(), (DWORD)data.size());
+				if (compressedSize != 0 && compressedSize < data.size() * 9 / 10)
+				{
+					entry.flags |= ARCHIVE_COMPRESSED;
+					entry.storedSize = compressedSize;
+					blob = compressed.data();
+				}
+			}
+
+			// Align the blob
+			unsigned long long position = archive.tellp();
+			unsigned long long padding = (ARCHIVE_ALIGNMENT - position % ARCHIVE_ALIGNMENT) % ARCHIVE_ALIGNMENT;
+			archive.write("\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0", padding);
+			entry.offset = position + padding;
+
+			archive.write(reinterpret_cast<const char*>(blob), entry.storedSize);
+			entries.push_back(entry);
+		}
+
+		// The table of contents, sorted by path hash, followed by the paths
+		sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.pathHash < b.pathHash; });
+		unsigned long long position = archive.tellp();
+		unsigned long long padding = (ARCHIVE_ALIGNMENT - position % ARCHIVE_ALIGNMENT) % ARCHIVE_ALIGNMENT;
+		archive.write("\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0", padding);
+		archive.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(Entry));
+		archive.write(pathTable.data(), pathTable.size());
+
+		memcpy(header.magic, ARCHIVE_MAGIC, sizeof(header.magic));
+		header.version = ARCHIVE_VERSION;
+		header.entryCount = (unsigned int)entries.size();
+		header.pathTableSize = (unsigned int)pathTable.size();
+		header.tocOffset = position + padding;
+		archive.seekp(0);
+		archive.write(reinterpret_cast<char*>(&header), sizeof(header));
+
+		archive.close();
+		if (archive.fail())
+		{
+			LOG_ERROR("AssetArchive: Failed to write \"" + archivePath + "\".");
+			return false;
+		}
+
+		return true;
+	}
+
+	bool AssetArchive::Open(const string& archivePath)
+	{
+		Close();
+
+		auto mappedFile = make_shared<MappedFile>();
+		if (!mappedFile->Open(archivePath))
+		{
+			LOG_ERROR("AssetArchive: Failed to map \"" + archivePath + "\".");
+			return false;
+		}
+
+		m_mappedFile = mappedFile;
+		m_data = mappedFile->GetData();
+		m_size = mappedFile->GetSize();
+		m_path = archivePath;
+
+		// Validate the header and the table of contents before trusting them
+		ArchiveHeader header;
+		bool valid = m_size >= sizeof(header);
+		if (valid)
+		{
+			memcpy(&header, m_data, sizeof(header));
+			valid = memcmp(header.magic, ARCHIVE_MAGIC, sizeof(header.magic)) == 0 && header.version == ARCHIVE_VERSION;
+			valid = valid && header.tocOffset <= m_size && (unsigned long long)header.entryCount * sizeof(Entry) + header.pathTableSize <= m_size - header.tocOffset;
+		}
+
+		if (!valid)
+		{
+			LOG_ERROR("AssetArchive: \"" + archivePath + "\" is not a valid archive.");
+			Close();
+			return false;
+		}
+
+		m_entries.resize(header.entryCount);
+		memcpy(m_entries.data(), m_data + header.tocOffset, m_entries.size() * sizeof(Entry));
+
+		const char* pathTable = reinterpret_cast<const char*>(m_data + header.tocOffset + m_entries.size() * sizeof(Entry));
+		m_pathTable.assign(pathTable, pathTable + header.pathTableSize);
+
+		// Every path has to be a terminated string inside the path table, and every blob inside the file
+		valid = m_pathTable.empty() || m_pathTable.back() == '\0';
+		for (const auto& entry : m_entries)
+		{
+			valid = valid && entry.pathOffset < m_pathTable.size();
+			valid = valid && entry.offset <= m_size && entry.storedSize <= m_size - entry.offset;
+		}
+
+		if (!valid)
+		{
+			LOG_ERROR("AssetArchive: \"" + archivePath + "\" has a corrupted table of contents.");
+			Close();
+			return false;
+		}
+
+		return true;
+	}
+
+	void AssetArchive::Close()
+	{
+		// Anything still viewing the mapping keeps it alive
+		m_mappedFile.reset();
+		m_data = nullptr;
+		m_size = 0;
+		m_entries.clear();
+		m_pathTable.clear();
+		m_path.clear();
+	}
+
+	const unsigned char* AssetArchive::GetData(const string& filePath, size_t& size, vector<unsigned char>& storage, shared_ptr<MappedFile>* mapping)
+	{
+		const Entry* entry = Find(filePath);
+		if (!entry || entry->offset + entry->storedSize > m_size)
+			return nullptr;
+
+		size = (size_t)entry->size;
+		if (!(entry->flags & ARCHIVE_COMPRESSED))
+		{
+			if (mapping) *mapping = m_mappedFile;
+			return m_data + entry->offset;
+		}
+
+		storage.resize(size);
+		DWORD decompressed = FreeImage_ZLibUncompress(storage.data(), (DWORD)size, const_cast<unsigned char*>(m_data + entry->offset), (DWORD)entry->storedSize);
+		if (decompressed != size)
+		{
+			LOG_ERROR("AssetArchive: Failed to decompress \"" + filePath + "\".");
+			return nullptr;
+		}
+
+		return storage.data();
+	}
+
+	vector<string> AssetArchive::GetFilePaths()
+	{
+		vector<string> filePaths;
+		for (const auto& entry : m_entries)
+		{
+			filePaths.push_back(&m_pathTable[entry.pathOffset]);
+		}
+
+		return filePaths;
+	}
+
+	//= MOUNTING =====================================================================================
+	bool AssetArchive::Mount(const string& archivePath)
+	{
+		auto archive = make_shared<AssetArchive>();
+		if (!archive->Open(archivePath))
+			return false;
+
+		lock_guard<mutex> lock(mountMutex);
+		mountedArchives.push_back(archive);
+
+		return true;
+	}
+
+	void AssetArchive::Unmount(const string& archivePath)
+	{
+		lock_guard<mutex> lock(mountMutex);
+		mountedArchives.erase(remove_if(mountedArchives.begin(), mountedArchives.end(),
+			[&archivePath](const shared_ptr<AssetArchive>& archive) { return archive->GetPath() == archivePath; }),
+			mountedArchives.end());
+	}
+
+	void AssetArchive::UnmountAll()
+	{
+		lock_guard<mutex> lock(mountMutex);
+		mountedArchives.clear();
+	}
+
+	bool AssetArchive::IsArchived(const string& filePath)
+	{
+		lock_guard<mutex> lock(mountMutex);
+		for (const auto& archive : mountedArchives)
+		{
+			if (archive->Contains(filePath))
+				return true;
+		}
+
+		return false;
+	}
+
+	const unsigned char* AssetArchive::GetArchivedData(const string& filePath, size_t& size, vector<unsigned char>& storage, shared_ptr<MappedFile>* mapping)
+	{
+		lock_guard<mutex> lock(mountMutex);
+		for (auto it = mountedArchives.rbegin(); it != mountedArchives.rend(); ++it)
+		{
+			if (const unsigned char* data = (*it)->GetData(filePath, size, storage, mapping))
+				return data;
+		}
+
+		return nullptr;
+	}
+	//================================================================================================
+
+	unsigned long long AssetArchive::HashPath(const string& filePath)
+	{
+		// 64-bit FNV-1a of the normalized path
+		unsigned long long hash = 14695981039346656037ULL;
+		for (char character : FileSystem::NormalizePath(filePath))
+		{
+			hash = (hash ^ (unsigned char)character) * 1099511628211ULL;
+		}
+
+		return hash;
+	}
+
+	const AssetArchive::Entry* AssetArchive::Find(const string& filePath)
+	{
+		if (m_entries.empty())
+			return nullptr;
+
+		unsigned long long hash = HashPath(filePath);
+		auto it = lower_bound(m_entries.begin(), m_entries.end(), hash, [](const Entry& entry, unsigned long long value) { return entry.pathHash < value; });
+		if (it == m_entries.end() || it->pathHash != hash)
+			return nullptr;
+
+		// Guard against a hash collision with a path that isn't in the archive
+		if (FileSystem::NormalizePath(filePath) != &m_pathTable[it->pathOffset])
+			return nullptr;
+
+		return &(*it);
+	}
+}
@@ -0,0 +1,95 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+#pragma once
+
+//= INCLUDES ==============
+#include <vector>
+#include <string>
+#include <memory>
+#include "../Core/Helper.h"
+//=========================
+
+#define ARCHIVE_EXTENSION ".pak"
+
+namespace Directus
+{
+	class MappedFile;
+
+	// A single file that packs many assets. Blobs are aligned and optionally zlib compressed,
+	// a table of contents sorted by path hash locates them. The archive is memory mapped, so
+	// uncompressed entries are read in place. Mounted archives are consulted by FileSystem,
+	// StreamIO, XmlDocument and ImageImporter before the disk, which makes them transparent.
+	class DLL_API AssetArchive
+	{
+	public:
+		AssetArchive();
+		~AssetArchive();
+
+		// Packs files into an archive, compressing the ones that shrink well when asked to
+		static bool Build(const std::string& archivePath, const std::vector<std::string>& filePaths, bool compress);
+
+		bool Open(const std::string& archivePath);
+		void Close();
+		bool IsOpen() { return m_data != nullptr; }
+		const std::string& GetPath() { return m_path; }
+
+		bool Contains(const std::string& filePath) { return Find(filePath) != nullptr; }
+		// Returns the entry's data, in place when it's uncompressed or decompressed into storage otherwise.
+		// Data read in place stays valid for as long as the mapping handed back is held.
+		const unsigned char* GetData(const std::string& filePath, size_t& size, std::vector<unsigned char>& storage, std::shared_ptr<MappedFile>* mapping = nullptr);
+		std::vector<std::string> GetFilePaths();
+
+		//= MOUNTING ===================================================================================================================================================
+		static bool Mount(const std::string& archivePath);
+		static void Unmount(const std::string& archivePath);
+		static void UnmountAll();
+		static bool IsArchived(const std::string& filePath);
+		static const unsigned char* GetArchivedData(const std::string& filePath, size_t& size, std::vector<unsigned char>& storage, std::shared_ptr<MappedFile>* mapping = nullptr);
+		//==============================================================================================================================================================
+
+		static unsigned long long HashPath(const std::string& filePath);
+
+	private:
+		struct Entry
+		{
+			unsigned long long pathHash;
+			unsigned long long offset;
+			unsigned long long size;
+			unsigned long long storedSize;
+			unsigned int flags;
+			unsigned int pathOffset;
+		};
+
+		const Entry* Find(const std::string& filePath);
+
+		std::string m_path;
+		// Sorted by path hash
+		std::vector<Entry> m_entries;
+		std::vector<char> m_pathTable;
+
+		// Memory mapping
+		std::shared_ptr<MappedFile> m_mappedFile;
+		const unsigned char* m_data;
+		size_t m_size;
+	};
+}
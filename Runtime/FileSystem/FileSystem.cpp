@@ -21,10 +21,16 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 //= INCLUDES ====================
 #include "FileSystem.h"
+#if defined(_MSC_VER)
 #include <filesystem>
+#else
+#include <experimental/filesystem>
+#endif
 #include <locale>
+#include <cstring>
 #include <regex>
 #include "../Logging/Log.h"
+#include "AssetArchive.h"
 //===============================
 
 //= NAMESPACES =========================
@@ -179,7 +185,7 @@ namespace Directus
 	//= FILES ============================================================================
 	bool FileSystem::FileExists(const string& filePath)
 	{
-		return fs::exists(filePath);
+		return AssetArchive::IsArchived(filePath) || fs::exists(filePath);
 	}
 
 	bool FileSystem::DeleteFile_(const string& filePath)
@@ -224,6 +230,21 @@ namespace Directus
 
 		return result;
 	}
+
+	bool FileSystem::GetFileStamp(const string& filePath, unsigned long long& size, long long& writeTime)
+	{
+		error_code error;
+		size = (unsigned long long)fs::file_size(filePath, error);
+		if (error)
+			return false;
+
+		auto time = fs::last_write_time(filePath, error);
+		if (error)
+			return false;
+		writeTime = (long long)time.time_since_epoch().count();
+
+		return true;
+	}
 	//====================================================================================
 
 	//= DIRECTORY PARSING ================================================================
@@ -671,6 +692,26 @@ namespace Directus
 	{
 		return regex_replace(str, regex(from), to);
 	}
+
+	string FileSystem::NormalizePath(const string& path)
+	{
+		string normalized;
+		normalized.reserve(path.size());
+		for (char character : path)
+		{
+			if (character == '\\')
+			{
+				character = '/';
+			}
+
+			if (character == '/' && !normalized.empty() && normalized.back() == '/')
+				continue;
+
+			normalized.push_back(character);
+		}
+
+		return normalized;
+	}
 	//=====================================================================================
 
 	//= SUPPORTED ASSET FILE FORMATS ==========================================================
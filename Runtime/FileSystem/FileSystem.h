@@ -23,6 +23,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 //= INCLUDES ==============
 #include <vector>
+#include <string>
 #include "../Core/Helper.h"
 //=========================
 
@@ -41,6 +42,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #define MODEL_EXTENSION ".model"
 #define PREFAB_EXTENSION ".prefab"
 #define SHADER_EXTENSION ".shader"
+#define TEXTURE_EXTENSION ".texture"
+#define MODEL_IMPORT_EXTENSION ".import"
 //=================================
 
 namespace Directus
@@ -61,6 +64,8 @@ namespace Directus
 		static bool FileExists(const std::string& path);
 		static bool DeleteFile_(const std::string& filePath);
 		static bool CopyFileFromTo(const std::string& source, const std::string& destination);
+		// Returns the size and last write time of a file, false if there's no such file
+		static bool GetFileStamp(const std::string& filePath, unsigned long long& size, long long& writeTime);
 		//====================================================================================
 
 		//= DIRECTORY PARSING  =================================================================
@@ -105,6 +110,8 @@ namespace Directus
 		static std::string ConvertToUppercase(const std::string& lower);
 		
 		static std::string ReplaceExpression(const std::string& str, const std::string& from, const std::string& to);
+		// Returns the path with forward slashes only, one at a time, so that paths can be compared
+		static std::string NormalizePath(const std::string& path);
 		//==============================================================================================================================================
 
 		//= SUPPORTED ASSET FILE FORMATS ===========================
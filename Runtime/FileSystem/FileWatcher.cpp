@@ -0,0 +1,393 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//= INCLUDES ==============
+#include "FileWatcher.h"
+#include "FileSystem.h"
+#include "../Logging/Log.h"
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <filesystem>
+#endif
+//=========================
+
+//= NAMESPACES ==============================
+using namespace std;
+using namespace chrono;
+#if !defined(__linux__) && !defined(_WIN32)
+namespace fs = experimental::filesystem;
+#endif
+//===========================================
+
+namespace Directus
+{
+	// The import cache writes and deletes its artefacts in here, none of which are sources
+	static bool IsIgnoredDirectory(const string& directory)
+	{
+		string name = FileSystem::NormalizePath(directory);
+		name = name.substr(name.find_last_of('/') + 1);
+		return name == "Cache";
+	}
+
+#ifdef _WIN32
+	struct FileWatcher::WatchedDirectory
+	{
+		string path;
+		HANDLE handle = INVALID_HANDLE_VALUE;
+		OVERLAPPED overlapped = {};
+		bool pending = false;
+		DWORD buffer[16 * 1024]; // ReadDirectoryChangesW needs it DWORD aligned
+
+		~WatchedDirectory()
+		{
+			// The system writes into the buffer until the read is cancelled
+			if (pending)
+			{
+				DWORD bytes = 0;
+				CancelIoEx(handle, &overlapped);
+				GetOverlappedResult(handle, &overlapped, &bytes, TRUE);
+			}
+
+			if (handle != INVALID_HANDLE_VALUE) CloseHandle(handle);
+			if (overlapped.hEvent) CloseHandle(overlapped.hEvent);
+		}
+	};
+
+	// Changes are reported relative to the watched directory, skip the ones under an ignored directory
+	static bool IsInIgnoredDirectory(const string& relativePath)
+	{
+		for (size_t slash = relativePath.find('/'); slash != string::npos; slash = relativePath.find('/', slash + 1))
+		{
+			if (IsIgnoredDirectory(relativePath.substr(0, slash)))
+				return true;
+		}
+
+		return false;
+	}
+#endif
+
+	FileWatcher::FileWatcher()
+	{
+		m_running = false;
+		m_debounceMs = 300;
+#ifdef __linux__
+		m_inotify = -1;
+#endif
+	}
+
+	FileWatcher::~FileWatcher()
+	{
+		Stop();
+	}
+
+	bool FileWatcher::Start(const vector<string>& directories)
+	{
+		Stop();
+
+		m_directories = directories;
+
+#ifdef __linux__
+		m_inotify = inotify_init1(IN_NONBLOCK);
+		if (m_inotify < 0)
+		{
+			LOG_ERROR("FileWatcher: Failed to initialize inotify.");
+			return false;
+		}
+
+		for (const auto& directory : m_directories)
+		{
+			AddWatch(FileSystem::NormalizePath(directory));
+		}
+#elif defined(_WIN32)
+		// One recursive watch per directory, the system queues changes until they are read
+		for (const auto& directory : m_directories)
+		{
+			auto watch = make_shared<WatchedDirectory>();
+			watch->path = FileSystem::NormalizePath(directory);
+			watch->handle = CreateFileA(directory.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+			watch->overlapped.hEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+			if (watch->handle == INVALID_HANDLE_VALUE || !watch->overlapped.hEvent || !ReadChanges(*watch))
+			{
+				LOG_WARNING("FileWatcher: Failed to watch \"" + directory + "\".");
+				continue;
+			}
+			m_watches.push_back(watch);
+		}
+#else
+		// Take a snapshot, so that only later changes get reported
+		Scan(false);
+#endif
+
+		m_running = true;
+		m_thread = thread(&FileWatcher::Run, this);
+
+		return true;
+	}
+
+	void FileWatcher::Stop()
+	{
+		if (!m_running)
+			return;
+
+		m_running = false;
+		m_thread.join();
+
+#ifdef __linux__
+		close(m_inotify);
+		m_inotify = -1;
+		m_watches.clear();
+#elif defined(_WIN32)
+		m_watches.clear();
+#else
+		m_timestamps.clear();
+#endif
+
+		lock_guard<mutex> lock(m_mutex);
+		m_pending.clear();
+	}
+
+	vector<string> FileWatcher::GetChangedFiles()
+	{
+		vector<string> changedFiles;
+		auto now = steady_clock::now();
+
+		lock_guard<mutex> lock(m_mutex);
+		for (auto it = m_pending.begin(); it != m_pending.end();)
+		{
+			if (duration_cast<milliseconds>(now - it->second).count() < m_debounceMs)
+			{
+				++it;
+				continue;
+			}
+
+			changedFiles.push_back(it->first);
+			it = m_pending.erase(it);
+		}
+
+		return changedFiles;
+	}
+
+	void FileWatcher::OnFileChanged(const string& filePath)
+	{
+		// Every change pushes the time back, the file is reported once it settles
+		lock_guard<mutex> lock(m_mutex);
+		m_pending[FileSystem::NormalizePath(filePath)] = steady_clock::now();
+	}
+
+#ifdef __linux__
+	void FileWatcher::Run()
+	{
+		// Large enough for a burst of events
+		alignas(inotify_event) char buffer[16 * 1024];
+
+		while (m_running)
+		{
+			pollfd descriptor = { m_inotify, POLLIN, 0 };
+			if (poll(&descriptor, 1, 100) <= 0)
+				continue;
+
+			ssize_t length = read(m_inotify, buffer, sizeof(buffer));
+			for (ssize_t offset = 0; offset < length;)
+			{
+				auto event = (const inotify_event*)(buffer + offset);
+				offset += sizeof(inotify_event) + event->len;
+
+				auto watch = m_watches.find(event->wd);
+				if (watch == m_watches.end() || event->len == 0)
+					continue;
+
+				string path = watch->second + "/" + event->name;
+
+				// Watch new directories as well
+				if (event->mask & IN_ISDIR)
+				{
+					if ((event->mask & (IN_CREATE | IN_MOVED_TO)) && !IsIgnoredDirectory(path))
+					{
+						AddWatch(path);
+					}
+					continue;
+				}
+
+				OnFileChanged(path);
+			}
+		}
+	}
+
+	void FileWatcher::AddWatch(const string& directory)
+	{
+		if (!FileSystem::DirectoryExists(directory))
+			return;
+
+		int watch = inotify_add_watch(m_inotify, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+		if (watch < 0)
+		{
+			LOG_WARNING("FileWatcher: Failed to watch \"" + directory + "\".");
+			return;
+		}
+		m_watches[watch] = directory;
+
+		for (const auto& subDirectory : FileSystem::GetDirectoriesInDirectory(directory))
+		{
+			if (!IsIgnoredDirectory(subDirectory))
+			{
+				AddWatch(FileSystem::NormalizePath(subDirectory));
+			}
+		}
+	}
+#elif defined(_WIN32)
+	void FileWatcher::Run()
+	{
+		vector<HANDLE> events;
+		for (const auto& watch : m_watches)
+		{
+			events.push_back(watch->overlapped.hEvent);
+		}
+
+		while (m_running)
+		{
+			if (events.empty())
+			{
+				this_thread::sleep_for(milliseconds(100));
+				continue;
+			}
+
+			// Wake up now and then to see whether we should stop
+			DWORD result = WaitForMultipleObjects((DWORD)events.size(), events.data(), FALSE, 100);
+			if (result < WAIT_OBJECT_0 || result >= WAIT_OBJECT_0 + events.size())
+				continue;
+
+			WatchedDirectory& watch = *m_watches[result - WAIT_OBJECT_0];
+			watch.pending = false;
+
+			// Zero bytes means that more changed than the buffer could hold, those are lost
+			DWORD bytes = 0;
+			if (GetOverlappedResult(watch.handle, &watch.overlapped, &bytes, FALSE) && bytes > 0)
+			{
+				auto info = (const FILE_NOTIFY_INFORMATION*)watch.buffer;
+				while (true)
+				{
+					if (info->Action != FILE_ACTION_REMOVED && info->Action != FILE_ACTION_RENAMED_OLD_NAME)
+					{
+						int length = (int)(info->FileNameLength / sizeof(WCHAR));
+						int size = WideCharToMultiByte(CP_ACP, 0, info->FileName, length, nullptr, 0, nullptr, nullptr);
+						string name(size, '\0');
+						WideCharToMultiByte(CP_ACP, 0, info->FileName, length, &name[0], size, nullptr, nullptr);
+						name = FileSystem::NormalizePath(name);
+
+						// Directories get reported when their contents change, only files are of interest
+						string path = FileSystem::NormalizePath(watch.path + "/" + name);
+						if (!IsInIgnoredDirectory(name) && !FileSystem::DirectoryExists(path))
+						{
+							OnFileChanged(path);
+						}
+					}
+
+					if (info->NextEntryOffset == 0)
+						break;
+					info = (const FILE_NOTIFY_INFORMATION*)((const char*)info + info->NextEntryOffset);
+				}
+			}
+
+			if (!ReadChanges(watch))
+			{
+				LOG_WARNING("FileWatcher: Stopped watching \"" + watch.path + "\".");
+			}
+		}
+	}
+
+	bool FileWatcher::ReadChanges(WatchedDirectory& watch)
+	{
+		ResetEvent(watch.overlapped.hEvent);
+		DWORD filter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE;
+		watch.pending = ReadDirectoryChangesW(watch.handle, watch.buffer, sizeof(watch.buffer), TRUE, filter, nullptr, &watch.overlapped, nullptr) != 0;
+		return watch.pending;
+	}
+#else
+	void FileWatcher::Run()
+	{
+		while (m_running)
+		{
+			this_thread::sleep_for(milliseconds(250));
+			Scan(true);
+		}
+	}
+
+	void FileWatcher::Scan(bool report)
+	{
+		for (const auto& directory : m_directories)
+		{
+			if (!FileSystem::DirectoryExists(directory))
+				continue;
+
+			// Files come and go while we scan, anything that can't be read is skipped
+			error_code error;
+			fs::recursive_directory_iterator entry(directory, error), end;
+			for (; !error && entry != end; entry.increment(error))
+			{
+				fs::file_status status = entry->status(error);
+				if (error)
+				{
+					error.clear();
+					continue;
+				}
+
+				if (fs::is_directory(status))
+				{
+					if (IsIgnoredDirectory(entry->path().generic_string()))
+					{
+						entry.disable_recursion_pending();
+					}
+					continue;
+				}
+
+				if (!fs::is_regular_file(status))
+					continue;
+
+				auto writeTime = fs::last_write_time(entry->path(), error);
+				if (error)
+				{
+					error.clear();
+					continue;
+				}
+
+				string path = FileSystem::NormalizePath(entry->path().generic_string());
+				long long timestamp = writeTime.time_since_epoch().count();
+
+				auto it = m_timestamps.find(path);
+				bool changed = it == m_timestamps.end() || it->second != timestamp;
+				m_timestamps[path] = timestamp;
+
+				if (changed && report)
+				{
+					OnFileChanged(path);
+				}
+			}
+		}
+	}
+#endif
+}
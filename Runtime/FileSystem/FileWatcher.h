@@ -0,0 +1,83 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+//= INCLUDES ==============
+#include <vector>
+#include <map>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include "../Core/Helper.h"
+//=========================
+
+namespace Directus
+{
+	// Watches directories for file changes on a background thread. Uses inotify on Linux,
+	// ReadDirectoryChangesW on Windows and polls file modification times elsewhere. Changes
+	// are debounced, so a file that is being written in several steps is reported once,
+	// when it settles.
+	class DLL_API FileWatcher
+	{
+	public:
+		FileWatcher();
+		~FileWatcher();
+
+		// Starts watching the directories (and their subdirectories)
+		bool Start(const std::vector<std::string>& directories);
+		void Stop();
+		bool IsRunning() { return m_running; }
+
+		// Returns the files that changed and have been quiet since
+		std::vector<std::string> GetChangedFiles();
+
+		void SetDebounceInterval(int milliseconds) { m_debounceMs = milliseconds; }
+
+	private:
+		void Run();
+		void OnFileChanged(const std::string& filePath);
+
+		std::vector<std::string> m_directories;
+		std::map<std::string, std::chrono::steady_clock::time_point> m_pending;
+		std::thread m_thread;
+		std::mutex m_mutex;
+		std::atomic<bool> m_running;
+		int m_debounceMs;
+
+#ifdef __linux__
+		void AddWatch(const std::string& directory);
+		int m_inotify;
+		std::map<int, std::string> m_watches;
+#elif defined(_WIN32)
+		// A directory handle with its pending read, defined in the .cpp to keep <windows.h> out
+		struct WatchedDirectory;
+		bool ReadChanges(WatchedDirectory& directory);
+		std::vector<std::shared_ptr<WatchedDirectory>> m_watches;
+#else
+		void Scan(bool report);
+		std::map<std::string, long long> m_timestamps;
+#endif
+	};
+}
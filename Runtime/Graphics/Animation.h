@@ -84,4 +84,7 @@ namespace Directus
 		// Each channel controls a single node
 		std::vector<AnimationNode> m_channels;
 	};
+
+	template <>
+	inline ResourceType ToResourceType<Animation>() { return Animation_Resource; }
 }
\ No newline at end of file
@@ -51,6 +51,11 @@ namespace Directus
 		m_depthMap->SetAsRenderTarget();
 	}
 
+	size_t Cascade::GetMemoryUsage()
+	{
+		return m_depthMap ? m_depthMap->GetMemoryUsage() : 0;
+	}
+
 	ID3D11ShaderResourceView* Cascade::GetShaderResource()
 	{
 		return m_depthMap ? m_depthMap->GetShaderResourceView() : nullptr;
@@ -49,6 +49,7 @@ namespace Directus
 		ID3D11ShaderResourceView* GetShaderResource();
 		Math::Matrix ComputeProjectionMatrix(int cascadeIndex, const Math::Vector3 centerPos, const Math::Matrix& viewMatrix);
 		float GetSplit(int cascadeIndex);
+		size_t GetMemoryUsage();
 
 	private:
 		std::unique_ptr<D3D11RenderTexture> m_depthMap;
@@ -34,6 +34,7 @@ namespace Directus
 	D3D11IndexBuffer::D3D11IndexBuffer(D3D11GraphicsDevice* graphicsDevice) : m_graphics(graphicsDevice)
 	{
 		m_buffer = nullptr;
+		m_size = 0;
 	}
 
 	D3D11IndexBuffer::~D3D11IndexBuffer()
@@ -41,14 +42,13 @@ namespace Directus
 		SafeRelease(m_buffer);
 	}
 
-	bool D3D11IndexBuffer::Create(const vector<unsigned int>& indices)
+	bool D3D11IndexBuffer::Create(const unsigned int* indices, unsigned int indexCount)
 	{
-		if (!m_graphics->GetDevice() || indices.empty())
+		if (!m_graphics->GetDevice() || !indices || indexCount == 0)
 			return false;
 
 		unsigned int stride = sizeof(unsigned int);
-		float size = (unsigned int)indices.size();
-		unsigned int finalSize = stride * size;
+		unsigned int finalSize = stride * indexCount;
 
 		// fill in a buffer description.
 		D3D11_BUFFER_DESC bufferDesc;
@@ -62,7 +62,7 @@ namespace Directus
 
 		// fill in the subresource data.
 		D3D11_SUBRESOURCE_DATA initData;
-		initData.pSysMem = indices.data();
+		initData.pSysMem = indices;
 		initData.SysMemPitch = 0;
 		initData.SysMemSlicePitch = 0;
 
@@ -72,6 +72,7 @@ namespace Directus
 			LOG_ERROR("Failed to create index buffer");
 			return false;
 		}
+		m_size = finalSize;
 
 		return true;
 	}
@@ -34,11 +34,16 @@ namespace Directus
 		D3D11IndexBuffer(D3D11GraphicsDevice* graphicsDevice);
 		~D3D11IndexBuffer();
 
-		bool Create(const std::vector<unsigned int>& indices);
+		bool Create(const std::vector<unsigned int>& indices) { return Create(indices.data(), (unsigned int)indices.size()); }
+		bool Create(const unsigned int* indices, unsigned int indexCount);
 		bool SetIA();
 
+		// Size of the buffer in video memory
+		unsigned int GetMemoryUsage() { return m_size; }
+
 	private:
 		D3D11GraphicsDevice* m_graphics;
 		ID3D11Buffer* m_buffer;
+		unsigned int m_size;
 	};
 }
@@ -65,7 +65,7 @@ namespace Directus
 			return false;
 		}
 
-		m_width = height;
+		m_width = width;
 		m_height = height;
 
 		//= RENDER TARGET TEXTURE ========================================================================================================
@@ -207,4 +207,12 @@ namespace Directus
 		m_farPlane = farPlane;
 		m_orthographicProjectionMatrix = Matrix::CreateOrthographicLH(float(m_width), float(m_height), nearPlane, farPlane);
 	}
+
+	size_t D3D11RenderTexture::GetMemoryUsage()
+	{
+		// RGBA 32-bit float target, 24-bit depth with 8-bit stencil
+		size_t pixels = (size_t)m_width * m_height;
+		size_t size = m_renderTargetTexture ? pixels * 16 : 0;
+		return m_depthStencilBuffer ? size + pixels * 4 : size;
+	}
 }
\ No newline at end of file
@@ -41,6 +41,8 @@ namespace Directus
 		ID3D11ShaderResourceView* GetShaderResourceView() { return m_shaderResourceView; }
 		void CalculateOrthographicProjectionMatrix(float nearPlane, float farPlane);
 		const Math::Matrix& GetOrthographicProjectionMatrix() { return m_orthographicProjectionMatrix; }
+		// Video memory used by the render target and its depth buffer
+		size_t GetMemoryUsage();
 
 	private:
 		// Texture
@@ -51,6 +51,7 @@ namespace Directus
 		m_vertexShader = nullptr;
 		m_pixelShader = nullptr;
 		m_VSBlob = nullptr;
+		m_PSBlob = nullptr;
 		m_compiled = false;
 		m_entrypoint = NOT_ASSIGNED;
 		m_profile = NOT_ASSIGNED;
@@ -64,6 +65,8 @@ namespace Directus
 	{
 		SafeRelease(m_vertexShader);
 		SafeRelease(m_pixelShader);
+		SafeRelease(m_VSBlob);
+		SafeRelease(m_PSBlob);
 
 		// delete samplers
 		m_samplers.clear();
@@ -71,8 +74,16 @@ namespace Directus
 	}
 
 	bool D3D11Shader::Load(const string& filePath)
+	{
+		return Compile(filePath) && Create();
+	}
+
+	bool D3D11Shader::Compile(const string& filePath)
 	{
 		m_filePath = filePath;
+		m_compiled = false;
+		SafeRelease(m_VSBlob);
+		SafeRelease(m_PSBlob);
 
 		//= Vertex shader =================================================
 		vector<D3D_SHADER_MACRO> vsMacros = m_macros;
@@ -80,18 +91,9 @@ namespace Directus
 		vsMacros.push_back(D3D_SHADER_MACRO{ "COMPILE_PS", "0" });
 		vsMacros.push_back(D3D_SHADER_MACRO{ nullptr, nullptr });
 
-		m_compiled = CompileVertexShader(
-			&m_VSBlob,
-			&m_vertexShader,
-			m_filePath,
-			"DirectusVertexShader",
-			"vs_5_0",
-			&vsMacros.front()
-		);
-		//=================================================================
-
-		if (!m_compiled)
+		if (!CompileShader(m_filePath, &vsMacros.front(), "DirectusVertexShader", "vs_5_0", &m_VSBlob))
 			return false;
+		//=================================================================
 
 		//= Pixel shader ===================================================	
 		vector<D3D_SHADER_MACRO> psMacros = m_macros;
@@ -99,20 +101,40 @@ namespace Directus
 		psMacros.push_back(D3D_SHADER_MACRO{ "COMPILE_PS", "1" });
 		psMacros.push_back(D3D_SHADER_MACRO{ nullptr, nullptr });
 
-		ID3D10Blob* PSBlob = nullptr;
-		m_compiled = CompilePixelShader(
-			&PSBlob,
-			&m_pixelShader,
-			m_filePath,
-			"DirectusPixelShader",
-			"ps_5_0",
-			&psMacros.front()
-		);
-
-		SafeRelease(PSBlob);
+		if (!CompileShader(m_filePath, &psMacros.front(), "DirectusPixelShader", "ps_5_0", &m_PSBlob))
+			return false;
 		//==================================================================
 
-		return m_compiled;
+		return true;
+	}
+
+	bool D3D11Shader::Create()
+	{
+		if (!m_graphics->GetDevice() || !m_VSBlob || !m_PSBlob)
+			return false;
+
+		SafeRelease(m_vertexShader);
+		SafeRelease(m_pixelShader);
+
+		auto result = m_graphics->GetDevice()->CreateVertexShader(m_VSBlob->GetBufferPointer(), m_VSBlob->GetBufferSize(), nullptr, &m_vertexShader);
+		if (FAILED(result))
+		{
+			LOG_ERROR("D3D11Shader: Failed to create vertex shader.");
+			return false;
+		}
+
+		result = m_graphics->GetDevice()->CreatePixelShader(m_PSBlob->GetBufferPointer(), m_PSBlob->GetBufferSize(), nullptr, &m_pixelShader);
+		if (FAILED(result))
+		{
+			LOG_ERROR("D3D11Shader: Failed to create pixel shader.");
+			return false;
+		}
+
+		// The vertex shader blob is still needed by the input layout
+		SafeRelease(m_PSBlob);
+		m_compiled = true;
+
+		return true;
 	}
 
 	bool D3D11Shader::SetInputLayout(InputLayout inputLayout)
@@ -204,47 +226,6 @@ namespace Directus
 	}
 
 	//= COMPILATION ================================================================================================================================================================================
-	bool D3D11Shader::CompileVertexShader(ID3D10Blob** vsBlob, ID3D11VertexShader** vertexShader, string path, LPCSTR entrypoint, LPCSTR profile, D3D_SHADER_MACRO* macros)
-	{
-		if (!m_graphics->GetDevice())
-			return false;
-
-		if (!CompileShader(path, macros, entrypoint, profile, vsBlob))
-			return false;
-
-		// Create the shader from the buffer.
-		ID3D10Blob* vsb = *vsBlob;
-		auto result = m_graphics->GetDevice()->CreateVertexShader(vsb->GetBufferPointer(), vsb->GetBufferSize(), nullptr, vertexShader);
-		if (FAILED(result))
-		{
-			LOG_ERROR("D3D11Shader: Failed to create vertex shader.");
-			return false;
-		}
-
-		return true;
-	}
-
-	bool D3D11Shader::CompilePixelShader(ID3D10Blob** psBlob, ID3D11PixelShader** pixelShader, string path, LPCSTR entrypoint, LPCSTR profile, D3D_SHADER_MACRO* macros)
-	{
-		if (!m_graphics->GetDevice())
-			return false;
-
-		auto result = CompileShader(path, macros, entrypoint, profile, psBlob);
-		if (FAILED(result))
-			return false;
-
-		// Create the shader from the buffer.
-		ID3D10Blob* psb = *psBlob;
-		result = m_graphics->GetDevice()->CreatePixelShader(psb->GetBufferPointer(), psb->GetBufferSize(), nullptr, pixelShader);
-		if (FAILED(result))
-		{
-			LOG_ERROR("D3D11Shader: Failed to create pixel shader.");
-			return false;
-		}
-
-		return true;
-	}
-
 	bool D3D11Shader::CompileShader(string filePath, D3D_SHADER_MACRO* macros, LPCSTR entryPoint, LPCSTR target, ID3DBlob** shaderBlobOut)
 	{
 		unsigned compileFlags = D3DCOMPILE_ENABLE_STRICTNESS | D3DCOMPILE_OPTIMIZATION_LEVEL3;
@@ -42,7 +42,12 @@ namespace Directus
 		D3D11Shader(D3D11GraphicsDevice* graphicsDevice);
 		~D3D11Shader();
 
+		// Compiles and creates the shaders
 		bool Load(const std::string& filePath);
+		// Only compiles the shaders, which doesn't touch the device, so it can run on any thread
+		bool Compile(const std::string& filePath);
+		// Creates the shaders from what Compile() produced
+		bool Create();
 		bool SetInputLayout(InputLayout inputLayout);
 		bool AddSampler(D3D11_FILTER filter, D3D11_TEXTURE_ADDRESS_MODE textureAddressMode, D3D11_COMPARISON_FUNC comparisonFunction);
 		void Set();
@@ -55,8 +60,6 @@ namespace Directus
 
 	private:
 		//= COMPILATION ================================================================================================================================================================================
-		bool CompileVertexShader(ID3D10Blob** vsBlob, ID3D11VertexShader** vertexShader, std::string path, LPCSTR entrypoint, LPCSTR profile, D3D_SHADER_MACRO* macros);
-		bool CompilePixelShader(ID3D10Blob** psBlob, ID3D11PixelShader** pixelShader, std::string path, LPCSTR entrypoint, LPCSTR profile, D3D_SHADER_MACRO* macros);
 		bool CompileShader(std::string filePath, D3D_SHADER_MACRO* macros, LPCSTR entryPoint, LPCSTR target, ID3DBlob** shaderBlobOut);
 		void LogD3DCompilerError(ID3D10Blob* errorMessage);
 
@@ -73,6 +76,7 @@ namespace Directus
 		ID3D11VertexShader* m_vertexShader;
 		ID3D11PixelShader* m_pixelShader;
 		ID3D10Blob* m_VSBlob = nullptr;
+		ID3D10Blob* m_PSBlob = nullptr;
 
 		//= MACROS ============================
 		std::vector<D3D_SHADER_MACRO> m_macros;
@@ -51,6 +51,9 @@ namespace Directus
 		if (!m_graphics->GetDevice())
 			return false;
 
+		// Release the previous view, in case the texture is being recreated
+		SafeRelease(m_shaderResourceView);
+
 		unsigned int mipLevels = 1;
 
 		//= SUBRESROUCE DATA =======================================================================
@@ -110,6 +113,9 @@ namespace Directus
 		if (!m_graphics->GetDevice())
 			return false;
 
+		// Release the previous view, in case the texture is being recreated
+		SafeRelease(m_shaderResourceView);
+
 		unsigned int mipLevels = 7;
 
 		//= ID3D11Texture2D ========================================================================
@@ -176,6 +182,9 @@ namespace Directus
 		if (!m_graphics->GetDevice())
 			return false;
 
+		// Release the previous view, in case the texture is being recreated
+		SafeRelease(m_shaderResourceView);
+
 		unsigned int mipLevels = (unsigned int)mipchain.size();
 
 		//= SUBRESOURCE DATA & TEXTURE DESCRIPTIONS ==============================================
@@ -35,6 +35,7 @@ namespace Directus
 	{
 		m_buffer = nullptr;
 		m_stride = 0;
+		m_size = 0;
 	}
 
 	D3D11VertexBuffer::~D3D11VertexBuffer()
@@ -73,6 +74,7 @@ namespace Directus
 			LOG_ERROR("Failed to create vertex buffer");
 			return false;
 		}
+		m_size = byteWidth;
 
 		return true;
 	}
@@ -108,18 +110,18 @@ namespace Directus
 			LOG_ERROR("Failed to create vertex buffer");
 			return false;
 		}
+		m_size = byteWidth;
 
 		return true;
 	}
 
-	bool D3D11VertexBuffer::Create(const vector<VertexPosTexTBN>& vertices)
+	bool D3D11VertexBuffer::Create(const VertexPosTexTBN* vertices, unsigned int vertexCount)
 	{
-		if (!m_graphics || !m_graphics->GetDevice() || vertices.empty())
+		if (!m_graphics || !m_graphics->GetDevice() || !vertices || vertexCount == 0)
 			return false;
 
 		m_stride = sizeof(VertexPosTexTBN);
-		float size = (unsigned int)vertices.size();
-		unsigned int byteWidth = m_stride * size;
+		unsigned int byteWidth = m_stride * vertexCount;
 
 		// fill in a buffer description.
 		D3D11_BUFFER_DESC bufferDesc;
@@ -133,7 +135,7 @@ namespace Directus
 
 		// fill in the subresource data.
 		D3D11_SUBRESOURCE_DATA initData;
-		initData.pSysMem = vertices.data();
+		initData.pSysMem = vertices;
 		initData.SysMemPitch = 0;
 		initData.SysMemSlicePitch = 0;
 
@@ -143,6 +145,7 @@ namespace Directus
 			LOG_ERROR("Failed to create vertex buffer");
 			return false;
 		}
+		m_size = byteWidth;
 
 		return true;
 	}
@@ -171,6 +174,7 @@ namespace Directus
 			LOG_ERROR("Failed to create vertex buffer");
 			return false;
 		}
+		m_size = byteWidth;
 
 		return true;
 	}
@@ -37,7 +37,8 @@ namespace Directus
 
 		bool Create(const std::vector<VertexPosCol>& vertices);
 		bool Create(const std::vector<VertexPosTex>& vertices);
-		bool Create(const std::vector<VertexPosTexTBN>& vertices);
+		bool Create(const std::vector<VertexPosTexTBN>& vertices) { return Create(vertices.data(), (unsigned int)vertices.size()); }
+		bool Create(const VertexPosTexTBN* vertices, unsigned int vertexCount);
 		bool CreateDynamic(unsigned int stride, unsigned int initialSize);
 
 		void* Map();
@@ -45,9 +46,13 @@ namespace Directus
 
 		bool SetIA();
 
+		// Size of the buffer in video memory
+		unsigned int GetMemoryUsage() { return m_size; }
+
 	private:
 		D3D11GraphicsDevice* m_graphics;
 		ID3D11Buffer* m_buffer;
 		unsigned int m_stride;
+		unsigned int m_size;
 	};
 }
@@ -39,12 +39,13 @@ using namespace Directus::Math;
 
 namespace Directus
 {
-	ShaderVariation::ShaderVariation()
+	ShaderVariation::ShaderVariation(Context* context)
 	{
 		// Resource
 		InitializeResource(Shader_Resource);
 
-		m_graphics = nullptr;
+		m_context = context;
+		m_graphics = m_context ? m_context->GetSubsystem<Graphics>() : nullptr;
 		m_shaderFlags = 0;
 	}
 
@@ -60,32 +61,58 @@ namespace Directus
 
 		// Save the properties of the material
 		m_shaderFlags = shaderFlags;
+		m_shaderFilePath = GetResourceFilePath();
 
-		Compile(GetResourceFilePath());
+		Compile(m_shaderFilePath);
 	}
 
-	bool ShaderVariation::LoadFromFile(const string& filePath)
+	string ShaderVariation::GetVariationPath(const string& shaderFilePath, unsigned long shaderFlags)
+	{
+		return shaderFilePath + "#" + to_string(shaderFlags);
+	}
+
+	bool ShaderVariation::Decode(const string& filePath)
 	{
-		if (!StreamIO::StartReading(filePath))
+		size_t separator = filePath.find_last_of('#');
+		if (separator == string::npos)
+		{
+			LOG_ERROR("ShaderVariation: \"" + filePath + "\" isn't a variation path.");
 			return false;
+		}
 
-		SetResourceName(StreamIO::ReadSTR());
-		SetResourceFilePath(StreamIO::ReadSTR());
-		m_shaderFlags = StreamIO::ReadULong();
+		m_shaderFilePath = filePath.substr(0, separator);
+		m_shaderFlags = stoul(filePath.substr(separator + 1));
+		SetResourceFilePath(filePath);
+		SetResourceName(FileSystem::GetFileNameFromFilePath(m_shaderFilePath) + "_" + to_string(m_shaderFlags));
 
-		StreamIO::StopReading();
+		return CompileSource(m_shaderFilePath);
+	}
 
-		return true;
+	bool ShaderVariation::Commit(const string& filePath)
+	{
+		return CreateDeviceObjects();
+	}
+
+	bool ShaderVariation::LoadFromFile(const string& filePath)
+	{
+		StreamIO stream(filePath, Stream_Read);
+		if (!stream.IsOpen())
+			return false;
+
+		SetResourceName(stream.ReadSTR());
+		SetResourceFilePath(stream.ReadSTR());
+		m_shaderFlags = stream.ReadULong();
+
+		return !stream.HasError();
 	}
 
 	bool ShaderVariation::SaveToFile(const string& filePath)
 	{
-		string savePath = filePath;
+		// Cached variations are compiled from their shader's source, there is nothing to save back
+		if (filePath == RESOURCE_SAVE)
+			return true;
 
-		if (savePath == RESOURCE_SAVE)
-		{
-			savePath = GetResourceFilePath();
-		}
+		string savePath = filePath;
 
 		// Add shader extension if missing
 		if (FileSystem::GetExtensionFromFilePath(filePath) != SHADER_EXTENSION)
@@ -93,16 +120,15 @@ namespace Directus
 			savePath += SHADER_EXTENSION;
 		}
 
-		if (!StreamIO::StartWriting(savePath))
+		StreamIO stream(savePath, Stream_Write);
+		if (!stream.IsOpen())
 			return false;
 
-		StreamIO::WriteSTR(GetResourceName());
-		StreamIO::WriteSTR(GetResourceFilePath());
-		StreamIO::WriteULong(m_shaderFlags);
-	
-		StreamIO::StopWriting();
+		stream.WriteSTR(GetResourceName());
+		stream.WriteSTR(GetResourceFilePath());
+		stream.WriteULong(m_shaderFlags);
 
-		return true;
+		return stream.Close();
 	}
 
 	void ShaderVariation::Set()
@@ -276,17 +302,32 @@ namespace Directus
 	}
 
 	void ShaderVariation::Compile(const string& filePath)
+	{
+		if (CompileSource(filePath))
+		{
+			CreateDeviceObjects();
+		}
+	}
+
+	bool ShaderVariation::CompileSource(const string& filePath)
 	{
 		if (!m_graphics)
 		{
 			LOG_INFO("GraphicsDevice is expired. Cant't compile shader");
-			return;
+			return false;
 		}
 
-		// Load and compile the vertex and the pixel shader
+		// Compile the vertex and the pixel shader
 		m_D3D11Shader = make_shared<D3D11Shader>(m_graphics);
 		AddDefinesBasedOnMaterial(m_D3D11Shader);
-		m_D3D11Shader->Load(filePath);
+		return m_D3D11Shader->Compile(filePath);
+	}
+
+	bool ShaderVariation::CreateDeviceObjects()
+	{
+		if (!m_D3D11Shader || !m_D3D11Shader->Create())
+			return false;
+
 		m_D3D11Shader->SetInputLayout(PositionTextureTBN);
 		m_D3D11Shader->AddSampler(D3D11_FILTER_ANISOTROPIC, D3D11_TEXTURE_ADDRESS_WRAP, D3D11_COMPARISON_ALWAYS);
 		m_D3D11Shader->AddSampler(D3D11_FILTER_MIN_MAG_MIP_LINEAR, D3D11_TEXTURE_ADDRESS_CLAMP, D3D11_COMPARISON_LESS_EQUAL);
@@ -302,5 +343,7 @@ namespace Directus
 		// Object Buffer
 		m_miscBuffer = make_shared<D3D11ConstantBuffer>(m_graphics);
 		m_miscBuffer->Create(sizeof(PerFrameBufferType));
+
+		return true;
 	}
 }
\ No newline at end of file
@@ -56,14 +56,23 @@ namespace Directus
 	class ShaderVariation : public Resource
 	{
 	public:
-		ShaderVariation();
+		ShaderVariation(Context* context = nullptr);
 		~ShaderVariation();
 
 		void Initialize(Context* context, unsigned long shaderFlags);
+		// Compiles the shader again, e.g. after its source file changed
+		void Recompile() { Compile(m_shaderFilePath); }
+		const std::string& GetShaderFilePath() { return m_shaderFilePath; }
+
+		// The path a variation is cached and loaded under, the shader's file with the flags appended
+		static std::string GetVariationPath(const std::string& shaderFilePath, unsigned long shaderFlags);
 
 		//= RESOURCE INTERFACE ========================
 		bool LoadFromFile(const std::string& filePath);
 		bool SaveToFile(const std::string& filePath);
+		// Loading a variation path compiles on a worker and creates the D3D objects on commit
+		bool Decode(const std::string& filePath);
+		bool Commit(const std::string& filePath);
 		//=============================================
 
 		void Set();
@@ -87,9 +96,13 @@ namespace Directus
 	private:
 		void AddDefinesBasedOnMaterial(std::shared_ptr<D3D11Shader> shader);
 		void Compile(const std::string& filePath);
+		// Compile() split in two, the part that can run on any thread and the part that uses the device
+		bool CompileSource(const std::string& filePath);
+		bool CreateDeviceObjects();
 
 		//= PROPERTIES =======
 		unsigned long m_shaderFlags;
+		std::string m_shaderFilePath;
 
 		//= MISC ==================================================
 		Graphics* m_graphics;
@@ -139,4 +152,7 @@ namespace Directus
 		PerObjectBufferType perObjectBufferCPU;
 		//==========================================================
 	};
+
+	template <>
+	inline ResourceType ToResourceType<ShaderVariation>() { return Shader_Resource; }
 }
\ No newline at end of file
@@ -33,6 +33,8 @@ namespace Directus
 	GBuffer::GBuffer(Graphics* graphics)
 	{
 		m_graphics = graphics;
+		m_width = 0;
+		m_height = 0;
 
 		// Construct the skeleton of the G-Buffer
 		m_renderTargets.push_back(GBufferTex{ DXGI_FORMAT_R32G32B32A32_FLOAT, nullptr, nullptr, nullptr }); // albedo
@@ -59,6 +61,9 @@ namespace Directus
 		if (!m_graphics->GetDevice())
 			return false;
 
+		m_width = width;
+		m_height = height;
+
 		for (auto& renderTarget : m_renderTargets)
 		{
 			// Initialize the render target texture description.
@@ -151,4 +156,16 @@ namespace Directus
 
 		return m_renderTargets[index].shaderResourceView;
 	}
+
+	size_t GBuffer::GetMemoryUsage()
+	{
+		// All the targets are RGBA 32-bit float
+		size_t size = 0;
+		for (const auto& renderTarget : m_renderTargets)
+		{
+			size += renderTarget.renderTexture ? (size_t)m_width * m_height * 16 : 0;
+		}
+
+		return size;
+	}
 }
\ No newline at end of file
@@ -48,8 +48,13 @@ namespace Directus
 
 		ID3D11ShaderResourceView* GetShaderResource(int index);
 
+		// Video memory used by the render targets
+		size_t GetMemoryUsage();
+
 	private:
 		std::vector<GBufferTex> m_renderTargets;
+		int m_width;
+		int m_height;
 
 		// Dependencies
 		Graphics* m_graphics;
@@ -131,6 +131,49 @@ namespace Directus
 
 	//= RESOURCE INTERFACE =====================================
 	bool Material::LoadFromFile(const string& filePath)
+	{
+		if (!LoadFromXml(filePath))
+			return false;
+
+		// Load the textures (or get them, if they happen to be loaded)
+		for (auto& it : m_textures)
+		{
+			it.second.first = m_context->GetSubsystem<ResourceManager>()->Load<Texture>(it.second.second);
+		}
+
+		AcquireShader();
+
+		return true;
+	}
+
+	bool Material::Decode(const string& filePath)
+	{
+		if (!LoadFromXml(filePath))
+			return false;
+
+		// The textures have to be loaded before the material is committed
+		for (const auto& it : m_textures)
+		{
+			m_dependencies.push_back(make_pair(Texture_Resource, it.second.second));
+		}
+
+		// And so does its shader variation, which then compiles on a worker thread too
+		string shaderDirectory = m_context->GetSubsystem<ResourceManager>()->GetStandardResourceDirectory(Shader_Resource);
+		m_dependencies.push_back(make_pair(Shader_Resource, ShaderVariation::GetVariationPath(shaderDirectory + "GBuffer.hlsl", ComputeShaderFlags())));
+
+		return true;
+	}
+
+	bool Material::Commit(const string& filePath)
+	{
+		// The textures and the shader are loaded by now
+		AcquireTextures();
+		AcquireShader();
+
+		return true;
+	}
+
+	bool Material::LoadFromXml(const string& filePath)
 	{
 		// Make sure the path is relative
 		SetResourceFilePath(FileSystem::GetRelativeFilePath(filePath));
@@ -154,6 +197,8 @@ namespace Directus
 		m_uvOffset = XmlDocument::GetAttributeAsVector2("Material", "UV_Offset");
 		XmlDocument::GetAttribute("Material", "IsEditable", m_isEditable);
 
+		m_textures.clear();
+
 		int textureCount = XmlDocument::GetAttributeAsInt("Textures", "Count");
 		for (int i = 0; i < textureCount; i++)
 		{
@@ -161,28 +206,10 @@ namespace Directus
 			TextureType texType = (TextureType)XmlDocument::GetAttributeAsInt(nodeName, "Texture_Type");
 			string texPath = XmlDocument::GetAttributeAsStr(nodeName, "Texture_Path");
 
-			// If the texture happens to be loaded, get a reference to it
-			auto texture = weak_ptr<Texture>();
-			if (m_context)
-			{
-				texture = m_context->GetSubsystem<ResourceManager>()->GetResourceByPath<Texture>(texPath);
-			}
-
-			m_textures.insert(make_pair(texType, make_pair(texture, texPath)));
+			m_textures.insert(make_pair(texType, make_pair(weak_ptr<Texture>(), texPath)));
 		}
 		XmlDocument::Release();
 
-		// Load unloaded textures
-		for (auto& it : m_textures)
-		{
-			if (it.second.first.expired())
-			{
-				it.second.first = m_context->GetSubsystem<ResourceManager>()->Load<Texture>(it.second.second);
-			}
-		}
-
-		AcquireShader();
-
 		return true;
 	}
 	//==========================================================
@@ -286,6 +313,18 @@ namespace Directus
 	//==============================================================================
 
 	//= SHADER =====================================================================
+	void Material::AcquireTextures()
+	{
+		if (!m_context)
+			return;
+
+		// Get references to the textures, if they are loaded
+		for (auto& it : m_textures)
+		{
+			it.second.first = m_context->GetSubsystem<ResourceManager>()->GetResourceByPath<Texture>(it.second.second);
+		}
+	}
+
 	void Material::AcquireShader()
 	{
 		if (!m_context)
@@ -293,6 +332,11 @@ namespace Directus
 
 		// Add a shader to the pool based on this material, if a 
 		// matching shader already exists, it will be returned.
+		m_shader = CreateShaderBasedOnMaterial(ComputeShaderFlags());
+	}
+
+	unsigned long Material::ComputeShaderFlags()
+	{
 		unsigned long shaderFlags = 0;
 
 		if (HasTextureOfType(Albedo_Texture)) shaderFlags |= Variaton_Albedo;
@@ -305,7 +349,7 @@ namespace Directus
 		if (HasTextureOfType(Mask_Texture)) shaderFlags |= Variaton_Mask;
 		if (HasTextureOfType(CubeMap_Texture)) shaderFlags |= Variaton_Cubemap;
 
-		m_shader = CreateShaderBasedOnMaterial(shaderFlags);
+		return shaderFlags;
 	}
 
 	weak_ptr<ShaderVariation> Material::FindMatchingShader(unsigned long shaderFlags)
@@ -336,12 +380,10 @@ namespace Directus
 		shader->SetResourceFilePath(shaderDirectory + "GBuffer.hlsl");
 		shader->Initialize(m_context, shaderFlags);
 
-		// A GBuffer shader can exist multiple times in memory because it can have multiple variations.
-		// In order to avoid conflicts where the engine thinks it's the same shader, we randomize the
-		// path which will automatically create a resource ID based on that path. Hence we make sure that
-		// there are no conflicts. A more elegant way to handle this would be nice...
-		shader->SetResourceFilePath(GUIDGenerator::GenerateAsStr());
-		shader->SetResourceName("GBuffer.hlsl_" + to_string(shader->GetResourceID()));
+		// A GBuffer shader can exist multiple times in memory because it can have multiple variations,
+		// each one is cached under its own variation path, the same one that asynchronous loads use.
+		shader->SetResourceFilePath(ShaderVariation::GetVariationPath(shaderDirectory + "GBuffer.hlsl", shaderFlags));
+		shader->SetResourceName("GBuffer.hlsl_" + to_string(shaderFlags));
 
 		// Add the shader to the pool and return it
 		return m_context->GetSubsystem<ResourceManager>()->Add(shader);
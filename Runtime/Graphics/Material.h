@@ -65,6 +65,8 @@ namespace Directus
 		//= RESOURCE INTERFACE ======================================
 		bool LoadFromFile(const std::string& filePath);
 		bool SaveToFile(const std::string& filePath) { return true; }
+		bool Decode(const std::string& filePath);
+		bool Commit(const std::string& filePath);
 		//===========================================================
 
 		//= TEXTURES ==================================================================
@@ -77,7 +79,9 @@ namespace Directus
 		//=============================================================================
 
 		//= SHADER ====================================================================
+		void AcquireTextures();
 		void AcquireShader();
+		unsigned long ComputeShaderFlags();
 		std::weak_ptr<ShaderVariation> FindMatchingShader(unsigned long shaderFlags);
 		std::weak_ptr<ShaderVariation> CreateShaderBasedOnMaterial(unsigned long shaderFlags);
 		std::weak_ptr<ShaderVariation>& GetShader() { return m_shader; }
@@ -131,6 +135,7 @@ namespace Directus
 		//=============================================================================
 
 	private:
+		bool LoadFromXml(const std::string& filePath);
 		void TextureBasedMultiplierAdjustment();
 
 		std::weak_ptr<ShaderVariation> m_shader;
@@ -159,4 +164,7 @@ namespace Directus
 		Context* m_context;
 		//=================
 	};
+
+	template <>
+	inline ResourceType ToResourceType<Material>() { return Material_Resource; }
 }
\ No newline at end of file
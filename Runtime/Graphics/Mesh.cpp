@@ -22,11 +22,14 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 //= INCLUDES ========================
+#include <algorithm>
 #include "../Graphics/Mesh.h"
+#include "../Graphics/MeshBVH.h"
 #include "../Logging/Log.h"
 #include "../Core/GUIDGenerator.h"
 #include "../FileSystem/FileSystem.h"
 #include "../IO/StreamIO.h"
+#include "../FileSystem/MappedFile.h"
 //===================================
 
 //= NAMESPACES ================
@@ -46,8 +49,10 @@ namespace Directus
 		m_vertexCount = 0;
 		m_indexCount = 0;
 		m_triangleCount = 0;
+		m_memoryUsageGPU = 0;
 		m_boundingBox = BoundingBox();
-		m_onUpdate = nullptr;
+		m_mappedVertices = nullptr;
+		m_mappedIndices = nullptr;
 	}
 
 	Mesh::~Mesh()
@@ -61,89 +66,139 @@ namespace Directus
 	}
 
 	//= IO =========================================================================
-	void Mesh::Serialize()
+	void Mesh::Serialize(StreamIO* stream)
 	{
-		StreamIO::WriteUnsignedInt(m_id);
-		StreamIO::WriteUnsignedInt(m_gameObjID);
-		StreamIO::WriteUnsignedInt(m_modelID);
-		StreamIO::WriteSTR(m_name);
-		StreamIO::WriteUnsignedInt(m_vertexCount);
-		StreamIO::WriteUnsignedInt(m_indexCount);
-		StreamIO::WriteUnsignedInt(m_triangleCount);
-
-		for (const auto& vertex : m_vertices)
-		{
-			SaveVertex(vertex);
-		}
+		stream->WriteUnsignedInt(m_id);
+		stream->WriteUnsignedInt(m_gameObjID);
+		stream->WriteUnsignedInt(m_modelID);
+		stream->WriteSTR(m_name);
+		stream->WriteArray(GetVertexData(), m_vertexCount, VERTEX_LAYOUT_VERSION);
+		stream->WriteArray(GetIndexData(), m_indexCount);
+	}
 
-		for (const auto& index : m_indices)
-		{
-			StreamIO::WriteInt(index);
-		}
+	void Mesh::Deserialize(StreamIO* stream)
+	{
+		m_id = stream->ReadUnsignedInt();
+		m_gameObjID = stream->ReadUnsignedInt();
+		m_modelID = stream->ReadUnsignedInt();
+		m_name = stream->ReadSTR();
+		// A mapped stream hands out views, the mapping is held on to for as long as they are used
+		m_mapping = stream->GetMapping();
+		m_mappedVertices = stream->ViewArray(m_vertices, m_vertexCount, VERTEX_LAYOUT_VERSION);
+		m_mappedIndices = stream->ViewArray(m_indices, m_indexCount);
+
+		Update();
 	}
 
-	void Mesh::Deserialize()
+	void Mesh::DeserializeUnversioned(StreamIO* stream)
 	{
-		m_id = StreamIO::ReadUnsignedInt();
-		m_gameObjID = StreamIO::ReadUnsignedInt();
-		m_modelID = StreamIO::ReadUnsignedInt();
-		m_name = StreamIO::ReadSTR();
-		m_vertexCount = StreamIO::ReadUnsignedInt();
-		m_indexCount = StreamIO::ReadUnsignedInt();
-		m_triangleCount = StreamIO::ReadUnsignedInt();
-
-		for (unsigned int i = 0; i < m_vertexCount; i++)
+		m_id = stream->ReadUnsignedInt();
+		m_gameObjID = stream->ReadUnsignedInt();
+		m_modelID = stream->ReadUnsignedInt();
+		m_name = stream->ReadSTR();
+
+		unsigned int vertexCount = stream->ReadUnsignedInt();
+		unsigned int indexCount = stream->ReadUnsignedInt();
+		stream->ReadUnsignedInt(); // triangle count, Update() computes it
+
+		// Read one value at a time, these files are only read once before being saved again
+		ReleaseMapping();
+		m_vertices.clear();
+		for (unsigned int i = 0; i < vertexCount && !stream->HasError(); i++)
 		{
-			m_vertices.push_back(VertexPosTexTBN());
-			LoadVertex(m_vertices.back());
+			VertexPosTexTBN vertex;
+			vertex.position = stream->ReadVector3();
+			vertex.uv = stream->ReadVector2();
+			vertex.normal = stream->ReadVector3();
+			vertex.tangent = stream->ReadVector3();
+			vertex.bitangent = stream->ReadVector3();
+			m_vertices.push_back(vertex);
 		}
 
-		for (unsigned int i = 0; i < m_indexCount; i++)
+		m_indices.clear();
+		for (unsigned int i = 0; i < indexCount && !stream->HasError(); i++)
 		{
-			m_indices.push_back(StreamIO::ReadInt());
+			m_indices.push_back(stream->ReadUnsignedInt());
 		}
 
-		m_boundingBox.ComputeFromMesh(this);
+		Update();
 	}
 
 	void Mesh::SetVertices(const vector<VertexPosTexTBN>& vertices)
 	{
+		ReleaseMapping();
 		m_vertices = vertices;
 		Update();
 	}
 
 	void Mesh::SetIndices(const vector<unsigned int>& indices)
 	{
+		ReleaseMapping();
 		m_indices = indices;
 		Update();
 	}
+
+	void Mesh::ReleaseMapping()
+	{
+		if (!m_mapping)
+			return;
+
+		// Data that couldn't be viewed in place already lives in the vectors
+		if (m_mappedVertices != m_vertices.data())
+		{
+			m_vertices.assign(m_mappedVertices, m_mappedVertices + m_vertexCount);
+		}
+
+		if (m_mappedIndices != m_indices.data())
+		{
+			m_indices.assign(m_mappedIndices, m_mappedIndices + m_indexCount);
+		}
+
+		m_mapping.reset();
+		m_mappedVertices = nullptr;
+		m_mappedIndices = nullptr;
+	}
 	//==============================================================================
 
 	//= PROCESSING =================================================================
 	void Mesh::Update()
 	{
-		m_vertexCount = (unsigned int)m_vertices.size();
-		m_indexCount = (unsigned int)m_indices.size();
+		// Mapped data can't change, its counts come from the file
+		if (!m_mapping)
+		{
+			m_vertexCount = (unsigned int)m_vertices.size();
+			m_indexCount = (unsigned int)m_indices.size();
+		}
 		m_triangleCount = m_indexCount / 3;
 
 		m_boundingBox.ComputeFromMesh(this);
+		m_boundingSphere.ComputeFromMesh(this);
+		m_bvh.reset();
 
-		if (m_onUpdate)
+		for (const auto& subscriber : m_onUpdate)
 		{
-			m_onUpdate();
+			subscriber.second();
 		}
 	}
 
 	// This is attached to CreateBuffers() which is part of the MeshFilter component.
 	// Whenever something changes, the buffers are auto-updated.
-	void Mesh::SubscribeToUpdate(function<void()> function)
+	void Mesh::SubscribeToUpdate(void* subscriber, function<void()> function)
 	{
-		m_onUpdate = function;
+		if (!function)
+			return;
 
-		if (m_onUpdate)
+		UnsubscribeFromUpdate(subscriber);
+		m_onUpdate.push_back(make_pair(subscriber, function));
+		function();
+	}
+
+	void Mesh::UnsubscribeFromUpdate(void* subscriber)
+	{
+		m_onUpdate.erase(remove_if(m_onUpdate.begin(), m_onUpdate.end(), [subscriber](const pair<void*, function<void()>>& entry)
 		{
-			m_onUpdate();
-		}
+			return entry.first == subscriber;
+		}), m_onUpdate.end());
 	}
 
 	void Mesh::SetScale(float scale)
@@ -151,51 +206,22 @@ namespace Directus
 		SetScale(this, scale);
 		Update();
 	}
-	//==============================================================================
 
-	//= IO =========================================================================
-	void Mesh::SaveVertex(const VertexPosTexTBN& vertex)
+	const MeshBVH* Mesh::GetBVH()
 	{
-		StreamIO::WriteFloat(vertex.position.x);
-		StreamIO::WriteFloat(vertex.position.y);
-		StreamIO::WriteFloat(vertex.position.z);
-
-		StreamIO::WriteFloat(vertex.uv.x);
-		StreamIO::WriteFloat(vertex.uv.y);
-
-		StreamIO::WriteFloat(vertex.normal.x);
-		StreamIO::WriteFloat(vertex.normal.y);
-		StreamIO::WriteFloat(vertex.normal.z);
-
-		StreamIO::WriteFloat(vertex.tangent.x);
-		StreamIO::WriteFloat(vertex.tangent.y);
-		StreamIO::WriteFloat(vertex.tangent.z);
+		if (!m_bvh)
+		{
+			m_bvh = make_shared<MeshBVH>();
+			m_bvh->Build(GetVertexData(), m_vertexCount, GetIndexData(), m_indexCount);
+		}
 
-		StreamIO::WriteFloat(vertex.bitangent.x);
-		StreamIO::WriteFloat(vertex.bitangent.y);
-		StreamIO::WriteFloat(vertex.bitangent.z);
+		return m_bvh.get();
 	}
 
-	void Mesh::LoadVertex(VertexPosTexTBN& vertex)
+	size_t Mesh::GetMemoryUsage()
 	{
-		vertex.position.x = StreamIO::ReadFloat();
-		vertex.position.y = StreamIO::ReadFloat();
-		vertex.position.z = StreamIO::ReadFloat();
-
-		vertex.uv.x = StreamIO::ReadFloat();
-		vertex.uv.y = StreamIO::ReadFloat();
-
-		vertex.normal.x = StreamIO::ReadFloat();
-		vertex.normal.y = StreamIO::ReadFloat();
-		vertex.normal.z = StreamIO::ReadFloat();
-
-		vertex.tangent.x = StreamIO::ReadFloat();
-		vertex.tangent.y = StreamIO::ReadFloat();
-		vertex.tangent.z = StreamIO::ReadFloat();
-
-		vertex.bitangent.x = StreamIO::ReadFloat();
-		vertex.bitangent.y = StreamIO::ReadFloat();
-		vertex.bitangent.z = StreamIO::ReadFloat();
+		size_t size = (size_t)m_vertexCount * sizeof(VertexPosTexTBN) + (size_t)m_indexCount * sizeof(unsigned int);
+		return m_bvh ? size + m_bvh->GetMemoryUsage() : size;
 	}
 	//==============================================================================
 
@@ -24,20 +24,28 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 //= INCLUDES ==================
 #include <vector>
 #include <functional>
+#include <memory>
 #include "Vertex.h"
 #include "../Math/BoundingBox.h"
+#include "../Math/BoundingSphere.h"
 //==============================
 
 namespace Directus
 {
+	class MeshBVH;
+	class StreamIO;
+	class MappedFile;
+
 	class Mesh
 	{
 	public:
 		Mesh();
 		~Mesh();
 
-		void Serialize();
-		void Deserialize();
+		void Serialize(StreamIO* stream);
+		void Deserialize(StreamIO* stream);
+		// Reads a mesh from a .model file that predates MODEL_FILE_VERSION, into memory
+		void DeserializeUnversioned(StreamIO* stream);
 
 		unsigned int GetID() { return m_id; }
 
@@ -50,33 +58,52 @@ namespace Directus
 		const std::string& GetName() { return m_name; }
 		void SetName(const std::string& name) { m_name = name; }
 
-		std::vector<VertexPosTexTBN>& GetVertices() { return m_vertices; }
+		// Modifiable data, a mesh that views a mapped file copies it first
+		std::vector<VertexPosTexTBN>& GetVertices() { ReleaseMapping(); return m_vertices; }
 		void SetVertices(const std::vector<VertexPosTexTBN>& vertices);
 
-		std::vector<unsigned int>& GetIndices() { return m_indices; }
+		std::vector<unsigned int>& GetIndices() { ReleaseMapping(); return m_indices; }
 		void SetIndices(const std::vector<unsigned int>& indices);
 
-		void AddVertex(VertexPosTexTBN vertex) { m_vertices.push_back(vertex); }
-		void AddIndex(unsigned int index) { m_indices.push_back(index); }
+		void AddVertex(VertexPosTexTBN vertex) { ReleaseMapping(); m_vertices.push_back(vertex); }
+		void AddIndex(unsigned int index) { ReleaseMapping(); m_indices.push_back(index); }
+
+		// Read-only data, straight from the mapped file when the mesh was loaded from one
+		const VertexPosTexTBN* GetVertexData() const { return m_mapping ? m_mappedVertices : m_vertices.data(); }
+		const unsigned int* GetIndexData() const { return m_mapping ? m_mappedIndices : m_indices.data(); }
+		bool IsMapped() const { return m_mapping != nullptr; }
+		const std::shared_ptr<MappedFile>& GetMapping() const { return m_mapping; }
+		// Copies the mapped vertices and indices into the mesh, after which the file can be overwritten
+		void ReleaseMapping();
 
 		unsigned int GetVertexCount() const { return m_vertexCount; }
 		unsigned int GetIndexCount() const { return m_indexCount; }
 		unsigned int GetTriangleCount() const { return m_triangleCount; }
-		unsigned int GetIndexStart() { return !m_indices.empty() ? m_indices.front() : 0; }
+		unsigned int GetIndexStart() { return m_indexCount != 0 ? GetIndexData()[0] : 0; }
 		const Math::BoundingBox& GetBoundingBox() { return m_boundingBox; }
+		// Centered on the bounding box, computed along with it and shared by every filter of the mesh
+		const Math::BoundingSphere& GetBoundingSphere() { return m_boundingSphere; }
+
+		// Triangle hierarchy for exact ray tests, built on first use
+		const MeshBVH* GetBVH();
+
+		// System memory used by the vertices, the indices and the triangle hierarchy. Mapped
+		// data counts too, it stays resident for as long as the mesh is used.
+		size_t GetMemoryUsage();
+		// Video memory of the buffers that MeshFilters created for the mesh, they keep it up to date
+		void AddMemoryUsageGPU(size_t size) { m_memoryUsageGPU += size; }
+		void RemoveMemoryUsageGPU(size_t size) { m_memoryUsageGPU -= size; }
+		size_t GetMemoryUsageGPU() { return m_memoryUsageGPU; }
 
 		//= PROCESSING =================================================================
 		void Update();
-		void SubscribeToUpdate(std::function<void()> function);
+		// Meshes can be shared, each subscriber is called whenever the mesh updates
+		void SubscribeToUpdate(void* subscriber, std::function<void()> function);
+		void UnsubscribeFromUpdate(void* subscriber);
 		void SetScale(float scale);
 		//==============================================================================
 
 	private:
-		//= IO =========================================================================
-		static void SaveVertex(const VertexPosTexTBN& vertex);
-		static void LoadVertex(VertexPosTexTBN& vertex);
-		//==============================================================================
-
 		//= HELPER FUNCTIONS =============================
 		static void SetScale(Mesh* meshData, float scale);
 		//================================================
@@ -89,12 +116,20 @@ namespace Directus
 		std::vector<VertexPosTexTBN> m_vertices;
 		std::vector<unsigned int> m_indices;
 
+		// Set when the mesh was loaded from a mapped file, the views point into it
+		std::shared_ptr<MappedFile> m_mapping;
+		const VertexPosTexTBN* m_mappedVertices;
+		const unsigned int* m_mappedIndices;
+
 		unsigned int m_vertexCount;
 		unsigned int m_indexCount;
 		unsigned int m_triangleCount;
+		size_t m_memoryUsageGPU;
 
 		Math::BoundingBox m_boundingBox;
+		Math::BoundingSphere m_boundingSphere;
+		std::shared_ptr<MeshBVH> m_bvh;
 
-		std::function<void()> m_onUpdate;
+		std::vector<std::pair<void*, std::function<void()>>> m_onUpdate;
 	};
 }
\ No newline at end of file
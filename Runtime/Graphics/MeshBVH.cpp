@@ -0,0 +1,288 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//= INCLUDES ===================
+#include "MeshBVH.h"
+#include <algorithm>
+#include <cstring>
+#include "../Math/MathHelper.h"
+//==============================
+
+//= NAMESPACES ================
+using namespace std;
+using namespace Directus::Math;
+//=============================
+
+#define TRIANGLES_PER_LEAF 4
+#define HIT_EPSILON 0.0000001f
+
+namespace Directus
+{
+	MeshBVH::MeshBVH()
+	{
+		m_triangleCount = 0;
+	}
+
+	MeshBVH::~MeshBVH()
+	{
+		m_nodes.clear();
+		m_packets.clear();
+	}
+
+	void MeshBVH::Build(const VertexPosTexTBN* vertices, unsigned int vertexCount, const unsigned int* indices, unsigned int indexCount)
+	{
+		m_nodes.clear();
+		m_packets.clear();
+		m_triangleCount = 0;
+
+		vector<BuildTriangle> triangles;
+		triangles.reserve(indexCount / 3);
+		for (unsigned int i = 0; i + 2 < indexCount; i += 3)
+		{
+			if (indices[i] >= vertexCount || indices[i + 1] >= vertexCount || indices[i + 2] >= vertexCount)
+				continue;
+
+			BuildTriangle triangle;
+			triangle.v0 = vertices[indices[i]].position;
+			triangle.v1 = vertices[indices[i + 1]].position;
+			triangle.v2 = vertices[indices[i + 2]].position;
+			triangle.min = Vector3(Min(triangle.v0.x, Min(triangle.v1.x, triangle.v2.x)), Min(triangle.v0.y, Min(triangle.v1.y, triangle.v2.y)), Min(triangle.v0.z, Min(triangle.v1.z, triangle.v2.z)));
+			triangle.max = Vector3(Max(triangle.v0.x, Max(triangle.v1.x, triangle.v2.x)), Max(triangle.v0.y, Max(triangle.v1.y, triangle.v2.y)), Max(triangle.v0.z, Max(triangle.v1.z, triangle.v2.z)));
+			triangle.centroid = (triangle.v0 + triangle.v1 + triangle.v2) / 3.0f;
+			triangles.push_back(triangle);
+		}
+
+		m_triangleCount = (unsigned int)triangles.size();
+		if (m_triangleCount == 0)
+			return;
+
+		m_nodes.reserve(2 * m_triangleCount / TRIANGLES_PER_LEAF + 1);
+		m_packets.reserve(m_triangleCount / TRIANGLES_PER_LEAF + 1);
+		BuildNode(triangles, 0, m_triangleCount);
+	}
+
+	unsigned int MeshBVH::BuildNode(vector<BuildTriangle>& triangles, unsigned int start, unsigned int end)
+	{
+		unsigned int nodeIndex = (unsigned int)m_nodes.size();
+		m_nodes.push_back(Node());
+
+		// Bounds of the triangles and of their centroids
+		Vector3 min = Vector3::Infinity;
+		Vector3 max = Vector3::InfinityNeg;
+		Vector3 centroidMin = Vector3::Infinity;
+		Vector3 centroidMax = Vector3::InfinityNeg;
+		for (unsigned int i = start; i < end; i++)
+		{
+			const BuildTriangle& triangle = triangles[i];
+			min = Vector3(Min(min.x, triangle.min.x), Min(min.y, triangle.min.y), Min(min.z, triangle.min.z));
+			max = Vector3(Max(max.x, triangle.max.x), Max(max.y, triangle.max.y), Max(max.z, triangle.max.z));
+			centroidMin = Vector3(Min(centroidMin.x, triangle.centroid.x), Min(centroidMin.y, triangle.centroid.y), Min(centroidMin.z, triangle.centroid.z));
+			centroidMax = Vector3(Max(centroidMax.x, triangle.centroid.x), Max(centroidMax.y, triangle.centroid.y), Max(centroidMax.z, triangle.centroid.z));
+		}
+
+		Node node;
+		node.min[0] = min.x; node.min[1] = min.y; node.min[2] = min.z;
+		node.max[0] = max.x; node.max[1] = max.y; node.max[2] = max.z;
+
+		// Few enough triangles, make a leaf out of them
+		if (end - start <= TRIANGLES_PER_LEAF)
+		{
+			TrianglePacket packet;
+			memset(&packet, 0, sizeof(TrianglePacket));
+			for (unsigned int i = start; i < end; i++)
+			{
+				const BuildTriangle& triangle = triangles[i];
+				Vector3 edge1 = triangle.v1 - triangle.v0;
+				Vector3 edge2 = triangle.v2 - triangle.v0;
+				int slot = i - start;
+				packet.v0X[slot] = triangle.v0.x; packet.v0Y[slot] = triangle.v0.y; packet.v0Z[slot] = triangle.v0.z;
+				packet.edge1X[slot] = edge1.x; packet.edge1Y[slot] = edge1.y; packet.edge1Z[slot] = edge1.z;
+				packet.edge2X[slot] = edge2.x; packet.edge2Y[slot] = edge2.y; packet.edge2Z[slot] = edge2.z;
+			}
+
+			node.offset = (unsigned int)m_packets.size();
+			node.isLeaf = 1;
+			m_packets.push_back(packet);
+			m_nodes[nodeIndex] = node;
+			return nodeIndex;
+		}
+
+		// Split in the middle of the longest axis of the centroids, by count, so that the tree stays balanced
+		Vector3 extent = centroidMax - centroidMin;
+		int axis = extent.x > extent.y ? (extent.x > extent.z ? 0 : 2) : (extent.y > extent.z ? 1 : 2);
+		unsigned int middle = start + (end - start) / 2;
+		nth_element(triangles.begin() + start, triangles.begin() + middle, triangles.begin() + end, [axis](const BuildTriangle& a, const BuildTriangle& b)
+		{
+			return axis == 0 ? a.centroid.x < b.centroid.x : (axis == 1 ? a.centroid.y < b.centroid.y : a.centroid.z < b.centroid.z);
+		});
+
+		BuildNode(triangles, start, middle);
+		node.offset = BuildNode(triangles, middle, end);
+		node.isLeaf = 0;
+		m_nodes[nodeIndex] = node;
+
+		return nodeIndex;
+	}
+
+	float MeshBVH::HitDistance(const Ray& ray) const
+	{
+		if (m_nodes.empty())
+			return INFINITY;
+
+		Vector3 origin = ray.GetOrigin();
+		Vector3 direction = ray.GetDirection();
+		float originArray[3] = { origin.x, origin.y, origin.z };
+		float inverseDirection[3] =
+		{
+			direction.x != 0.0f ? 1.0f / direction.x : INFINITY,
+			direction.y != 0.0f ? 1.0f / direction.y : INFINITY,
+			direction.z != 0.0f ? 1.0f / direction.z : INFINITY
+		};
+
+		// Returns the entry distance of the ray into a node, or infinity if it misses it
+		auto hitNode = [&](const Node& node, float maxDistance)
+		{
+			float distMin = 0.0f;
+			float distMax = maxDistance;
+			for (int axis = 0; axis < 3; axis++)
+			{
+				float t1 = (node.min[axis] - originArray[axis]) * inverseDirection[axis];
+				float t2 = (node.max[axis] - originArray[axis]) * inverseDirection[axis];
+				// 0 * infinity gives NaN when the origin lies on a slab parallel to the ray, treat that as inside
+				if (t1 != t1) t1 = -INFINITY;
+				if (t2 != t2) t2 = INFINITY;
+				distMin = Max(distMin, Min(t1, t2));
+				distMax = Min(distMax, Max(t1, t2));
+			}
+			return distMin <= distMax ? distMin : INFINITY;
+		};
+
+		float nearest = INFINITY;
+		unsigned int stack[64];
+		int stackSize = 0;
+		stack[stackSize++] = 0;
+		while (stackSize > 0)
+		{
+			unsigned int nodeIndex = stack[--stackSize];
+			const Node& node = m_nodes[nodeIndex];
+			if (hitNode(node, nearest) == INFINITY)
+				continue;
+
+			if (node.isLeaf)
+			{
+				nearest = Min(nearest, HitDistance(m_packets[node.offset], origin, direction, nearest));
+				continue;
+			}
+
+			// Visit the nearest child first, so that the furthest one can be skipped more often
+			unsigned int first = nodeIndex + 1;
+			unsigned int second = node.offset;
+			float distanceFirst = hitNode(m_nodes[first], nearest);
+			float distanceSecond = hitNode(m_nodes[second], nearest);
+			if (distanceFirst > distanceSecond)
+			{
+				swap(first, second);
+				swap(distanceFirst, distanceSecond);
+			}
+
+			if (distanceSecond != INFINITY && stackSize < 64) stack[stackSize++] = second;
+			if (distanceFirst != INFINITY && stackSize < 64) stack[stackSize++] = first;
+		}
+
+		return nearest;
+	}
+
+	// Möller–Trumbore, against all the triangles of a packet at once
+	float MeshBVH::HitDistance(const TrianglePacket& packet, const Vector3& origin, const Vector3& direction, float maxDistance)
+	{
+#if defined(MATH_SIMD_SSE)
+		__m128 dirX = _mm_set1_ps(direction.x), dirY = _mm_set1_ps(direction.y), dirZ = _mm_set1_ps(direction.z);
+		__m128 e1X = _mm_loadu_ps(packet.edge1X), e1Y = _mm_loadu_ps(packet.edge1Y), e1Z = _mm_loadu_ps(packet.edge1Z);
+		__m128 e2X = _mm_loadu_ps(packet.edge2X), e2Y = _mm_loadu_ps(packet.edge2Y), e2Z = _mm_loadu_ps(packet.edge2Z);
+
+		// p = direction x edge2, det = edge1 . p
+		__m128 pX = _mm_sub_ps(_mm_mul_ps(dirY, e2Z), _mm_mul_ps(dirZ, e2Y));
+		__m128 pY = _mm_sub_ps(_mm_mul_ps(dirZ, e2X), _mm_mul_ps(dirX, e2Z));
+		__m128 pZ = _mm_sub_ps(_mm_mul_ps(dirX, e2Y), _mm_mul_ps(dirY, e2X));
+		__m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1X, pX), _mm_mul_ps(e1Y, pY)), _mm_mul_ps(e1Z, pZ));
+		__m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+		__m128 valid = _mm_cmpgt_ps(_mm_and_ps(det, absMask), _mm_set1_ps(HIT_EPSILON));
+		__m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+
+		// s = origin - v0, u = (s . p) / det
+		__m128 sX = _mm_sub_ps(_mm_set1_ps(origin.x), _mm_loadu_ps(packet.v0X));
+		__m128 sY = _mm_sub_ps(_mm_set1_ps(origin.y), _mm_loadu_ps(packet.v0Y));
+		__m128 sZ = _mm_sub_ps(_mm_set1_ps(origin.z), _mm_loadu_ps(packet.v0Z));
+		__m128 u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sX, pX), _mm_mul_ps(sY, pY)), _mm_mul_ps(sZ, pZ)), invDet);
+
+		// q = s x edge1, v = (direction . q) / det, t = (edge2 . q) / det
+		__m128 qX = _mm_sub_ps(_mm_mul_ps(sY, e1Z), _mm_mul_ps(sZ, e1Y));
+		__m128 qY = _mm_sub_ps(_mm_mul_ps(sZ, e1X), _mm_mul_ps(sX, e1Z));
+		__m128 qZ = _mm_sub_ps(_mm_mul_ps(sX, e1Y), _mm_mul_ps(sY, e1X));
+		__m128 v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dirX, qX), _mm_mul_ps(dirY, qY)), _mm_mul_ps(dirZ, qZ)), invDet);
+		__m128 t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2X, qX), _mm_mul_ps(e2Y, qY)), _mm_mul_ps(e2Z, qZ)), invDet);
+
+		__m128 zero = _mm_setzero_ps();
+		valid = _mm_and_ps(valid, _mm_cmpge_ps(u, zero));
+		valid = _mm_and_ps(valid, _mm_cmpge_ps(v, zero));
+		valid = _mm_and_ps(valid, _mm_cmple_ps(_mm_add_ps(u, v), _mm_set1_ps(1.0f)));
+		valid = _mm_and_ps(valid, _mm_cmpgt_ps(t, zero));
+		valid = _mm_and_ps(valid, _mm_cmplt_ps(t, _mm_set1_ps(maxDistance)));
+
+		// Nearest of the hits
+		t = _mm_or_ps(_mm_and_ps(valid, t), _mm_andnot_ps(valid, _mm_set1_ps(INFINITY)));
+		t = _mm_min_ps(t, _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 3, 0, 1)));
+		t = _mm_min_ps(t, _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 0, 3, 2)));
+		return _mm_cvtss_f32(t);
+#else
+		float nearest = INFINITY;
+		for (int i = 0; i < 4; i++)
+		{
+			Vector3 edge1 = Vector3(packet.edge1X[i], packet.edge1Y[i], packet.edge1Z[i]);
+			Vector3 edge2 = Vector3(packet.edge2X[i], packet.edge2Y[i], packet.edge2Z[i]);
+
+			Vector3 p = Vector3::Cross(direction, edge2);
+			float det = Vector3::Dot(edge1, p);
+			if (Abs(det) <= HIT_EPSILON)
+				continue;
+			float invDet = 1.0f / det;
+
+			Vector3 s = origin - Vector3(packet.v0X[i], packet.v0Y[i], packet.v0Z[i]);
+			float u = Vector3::Dot(s, p) * invDet;
+			if (u < 0.0f || u > 1.0f)
+				continue;
+
+			Vector3 q = Vector3::Cross(s, edge1);
+			float v = Vector3::Dot(direction, q) * invDet;
+			if (v < 0.0f || u + v > 1.0f)
+				continue;
+
+			float t = Vector3::Dot(edge2, q) * invDet;
+			if (t > 0.0f && t < maxDistance && t < nearest)
+			{
+				nearest = t;
+			}
+		}
+
+		return nearest;
+#endif
+	}
+}
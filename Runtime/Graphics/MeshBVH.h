@@ -0,0 +1,84 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+//= INCLUDES ===============
+#include <vector>
+#include "Vertex.h"
+#include "../Math/Ray.h"
+//==========================
+
+namespace Directus
+{
+	// A bounding volume hierarchy over the triangles of a mesh, used to find
+	// exactly where a ray hits it without testing every single triangle.
+	class MeshBVH
+	{
+	public:
+		MeshBVH();
+		~MeshBVH();
+
+		// Builds the hierarchy from a triangle list
+		void Build(const VertexPosTexTBN* vertices, unsigned int vertexCount, const unsigned int* indices, unsigned int indexCount);
+
+		// Returns the distance to the nearest triangle hit, or infinity if there is no hit.
+		// Triangles are hit from both sides.
+		float HitDistance(const Math::Ray& ray) const;
+
+		unsigned int GetTriangleCount() const { return m_triangleCount; }
+		unsigned int GetNodeCount() const { return (unsigned int)m_nodes.size(); }
+		size_t GetMemoryUsage() const { return m_nodes.size() * sizeof(Node) + m_packets.size() * sizeof(TrianglePacket); }
+
+	private:
+		// Leaves point to a packet, inner nodes have their first
+		// child right after them and the second one at "offset".
+		struct Node
+		{
+			float min[3];
+			float max[3];
+			unsigned int offset;
+			unsigned int isLeaf;
+		};
+
+		// Up to 4 triangles stored as SoA, so that they can be tested at once.
+		// Unused slots are degenerate (zero edges) and never hit.
+		struct TrianglePacket
+		{
+			float v0X[4], v0Y[4], v0Z[4];
+			float edge1X[4], edge1Y[4], edge1Z[4];
+			float edge2X[4], edge2Y[4], edge2Z[4];
+		};
+
+		struct BuildTriangle
+		{
+			Math::Vector3 v0, v1, v2;
+			Math::Vector3 min, max, centroid;
+		};
+
+		unsigned int BuildNode(std::vector<BuildTriangle>& triangles, unsigned int start, unsigned int end);
+		static float HitDistance(const TrianglePacket& packet, const Math::Vector3& origin, const Math::Vector3& direction, float maxDistance);
+
+		std::vector<Node> m_nodes;
+		std::vector<TrianglePacket> m_packets;
+		unsigned int m_triangleCount;
+	};
+}
@@ -31,6 +31,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Graphics/Animation.h"
 #include "../Graphics/DeferredShaders/ShaderVariation.h"
 #include "../IO/StreamIO.h"
+#include "../FileSystem/MappedFile.h"
+#include "../FileSystem/AssetArchive.h"
 //======================================================
 
 //= NAMESPACES ================
@@ -97,24 +99,100 @@ namespace Directus
 			savePath = GetResourceFilePath();
 		}
 
-		if (!StreamIO::StartWriting(savePath))
+		// Nothing changed since the model was loaded from or saved to this file
+		if (savePath == m_savedFilePath)
+			return true;
+
+		// Meshes viewing the very file that's about to be overwritten copy their data first
+		for (const auto& mesh : m_meshes)
+		{
+			if (mesh->IsMapped() && mesh->GetMapping()->GetPath() == savePath)
+			{
+				mesh->ReleaseMapping();
+			}
+		}
+
+		StreamIO stream(savePath, Stream_Write);
+		if (!stream.IsOpen())
 			return false;
 
-		StreamIO::WriteInt(GetResourceID());
-		StreamIO::WriteSTR(GetResourceName());
-		StreamIO::WriteSTR(GetResourceFilePath());
-		StreamIO::WriteFloat(m_normalizedScale);
-		StreamIO::WriteInt((int)m_meshes.size());
+		stream.WriteUnsignedInt(MODEL_FILE_TAG);
+		stream.WriteUnsignedInt(MODEL_FILE_VERSION);
+		stream.WriteInt(GetResourceID());
+		stream.WriteSTR(GetResourceName());
+		stream.WriteSTR(GetResourceFilePath());
+		stream.WriteFloat(m_normalizedScale);
+		stream.WriteInt((int)m_meshes.size());
 
 		for (const auto& mesh : m_meshes)
 		{
-			mesh->Serialize();
+			mesh->Serialize(&stream);
 		}
 
-		StreamIO::StopWriting();
+		if (!stream.Close())
+			return false;
 
+		m_savedFilePath = savePath;
 		return true;
 	}
+
+	bool Model::Decode(const string& filePath)
+	{
+		// Foreign formats go through the ModelImporter, which is loaded by Commit()
+		if (FileSystem::GetExtensionFromFilePath(filePath) != MODEL_EXTENSION)
+			return true;
+
+		if (!LoadFromEngineFormat(filePath))
+			return false;
+
+		// The materials of the model have to be loaded before it's committed
+		string materialDirectory = GetResourceDirectory() + "Materials//";
+		if (!FileSystem::DirectoryExists(materialDirectory))
+			return true;
+
+		for (const auto& file : FileSystem::GetFilesInDirectory(materialDirectory))
+		{
+			if (FileSystem::IsEngineMaterialFile(file))
+			{
+				m_dependencies.push_back(make_pair(Material_Resource, file));
+			}
+		}
+
+		return true;
+	}
+
+	bool Model::Commit(const string& filePath)
+	{
+		// Engine format models are fully loaded by Decode()
+		if (FileSystem::GetExtensionFromFilePath(filePath) == MODEL_EXTENSION)
+			return true;
+
+		return LoadFromFile(filePath);
+	}
+
+	size_t Model::GetMemoryUsageCPU()
+	{
+		size_t size = 0;
+		for (const auto& mesh : m_meshes)
+		{
+			size += mesh->GetMemoryUsage();
+		}
+
+		return size;
+	}
+
+	size_t Model::GetMemoryUsageGPU()
+	{
+		// Vertex and index buffers belong to the MeshFilters that render the model's
+		// meshes, they add their size to the mesh when they create them
+		size_t size = 0;
+		for (const auto& mesh : m_meshes)
+		{
+			size += mesh->GetMemoryUsageGPU();
+		}
+
+		return size;
+	}
 	//============================================================================================
 
 	weak_ptr<Mesh> Model::AddMeshAsNewResource(unsigned int gameObjID, const string& name, vector<VertexPosTexTBN> vertices, vector<unsigned int> indices)
@@ -145,6 +223,7 @@ namespace Directus
 
 		// Save it
 		m_meshes.push_back(mesh);
+		m_savedFilePath.clear();
 	}
 
 	weak_ptr<Material> Model::AddMaterialAsNewResource(shared_ptr<Material> material)
@@ -211,8 +290,19 @@ namespace Directus
 
 	string Model::CopyTextureToLocalDirectory(const string& from)
 	{
+		// A texture with the same content that's already in the project is used instead, so that
+		// textures shared by several models (or materials) are stored and loaded only once.
+		auto importCache = m_resourceManager->GetImportCache();
+		string contentKey = importCache._Get()->ComputeKey(from, 0);
+		string existing = importCache._Get()->FindCopy(contentKey);
+		if (!existing.empty())
+			return existing;
+
 		string textureDestination = GetResourceDirectory() + "Textures//" + FileSystem::GetFileNameFromFilePath(from);
-		FileSystem::CopyFileFromTo(from, textureDestination);
+		if (FileSystem::CopyFileFromTo(from, textureDestination))
+		{
+			importCache._Get()->RecordCopy(contentKey, textureDestination);
+		}
 
 		return textureDestination;
 	}
@@ -225,25 +315,64 @@ namespace Directus
 
 	bool Model::LoadFromEngineFormat(const string& filePath)
 	{
-		// Deserialize
-		if (!StreamIO::StartReading(filePath))
+		// Deserialize, the meshes view their vertices and indices in the mapped file
+		StreamIO stream(filePath, Stream_ReadMapped);
+		if (!stream.IsOpen())
 			return false;
 
-		SetResourceID(StreamIO::ReadInt());
-		SetResourceName(StreamIO::ReadSTR());
-		SetResourceFilePath(StreamIO::ReadSTR());
-		m_normalizedScale = StreamIO::ReadFloat();
-		int meshCount = StreamIO::ReadInt();
+		// Files without a tag start with the resource ID, a clash with the tag is a one in four billion
+		unsigned int tag = stream.ReadUnsignedInt();
+		bool isVersioned = tag == MODEL_FILE_TAG;
+		if (isVersioned)
+		{
+			unsigned int version = stream.ReadUnsignedInt();
+			if (version != MODEL_FILE_VERSION)
+			{
+				LOG_ERROR("Model: \"" + filePath + "\" has an unsupported version (" + to_string(version) + ").");
+				return false;
+			}
+		}
+
+		SetResourceID(isVersioned ? stream.ReadInt() : (int)tag);
+		SetResourceName(stream.ReadSTR());
+		SetResourceFilePath(stream.ReadSTR());
+		m_normalizedScale = stream.ReadFloat();
+		int meshCount = stream.ReadInt();
 
-		for (int i = 0; i < meshCount; i++)
+		for (int i = 0; i < meshCount && !stream.HasError(); i++)
 		{
 			auto mesh = make_shared<Mesh>();
-			mesh->Deserialize();
+			if (isVersioned)
+			{
+				mesh->Deserialize(&stream);
+			}
+			else
+			{
+				mesh->DeserializeUnversioned(&stream);
+			}
 			AddMeshAsNewResource(mesh);
 		}
 
-		StreamIO::StopReading();
+		if (stream.HasError())
+		{
+			LOG_ERROR("Model: \"" + filePath + "\" is corrupted.");
+			return false;
+		}
+
+		// Upgrade legacy files in place, their meshes live in memory so the file is free to overwrite.
+		// Archived files are read-only and keep taking the legacy path.
+		stream.Close();
+		if (!isVersioned && !AssetArchive::IsArchived(filePath))
+		{
+			LOG_INFO("Model: Upgrading \"" + filePath + "\" to the current format.");
+			if (!SaveToFile(filePath))
+			{
+				LOG_WARNING("Model: Failed to upgrade \"" + filePath + "\".");
+			}
+			return true;
+		}
 
+		m_savedFilePath = isVersioned ? filePath : "";
 		return true;
 	}
 
@@ -278,6 +407,8 @@ namespace Directus
 
 	void Model::SetScale(float scale)
 	{
+		m_savedFilePath.clear();
+
 		for (const auto& mesh : m_meshes)
 		{
 			mesh->SetScale(scale);
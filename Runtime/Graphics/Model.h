@@ -28,6 +28,10 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Math/BoundingBox.h"
 //===============================
 
+// .model files start with this tag and a version, files without them are read by a legacy path
+#define MODEL_FILE_TAG 0x4C444F4D // "MODL"
+#define MODEL_FILE_VERSION 1
+
 namespace Directus
 {
 	class ResourceManager;
@@ -51,6 +55,10 @@ namespace Directus
 		//= RESOURCE INTERFACE ================================
 		virtual bool LoadFromFile(const std::string& filePath);
 		virtual bool SaveToFile(const std::string& filePath);
+		virtual bool Decode(const std::string& filePath);
+		virtual bool Commit(const std::string& filePath);
+		virtual size_t GetMemoryUsageCPU();
+		virtual size_t GetMemoryUsageGPU();
 		//======================================================
 
 		// Sets the  GameObject that represents this model in the scene
@@ -105,8 +113,13 @@ namespace Directus
 
 		// Misc
 		bool m_isAnimated;
+		// The file the model was last loaded from or saved to, cleared when the model changes
+		std::string m_savedFilePath;
 
 		// Dependencies
 		ResourceManager* m_resourceManager;
 	};
+
+	template <>
+	inline ResourceType ToResourceType<Model>() { return Model_Resource; }
 }
\ No newline at end of file
@@ -44,6 +44,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Resource/ResourceManager.h"
 #include "../Font/Font.h"
 #include "../Profiling/PerformanceProfiler.h"
+#include "../Math/Frustrum.h"
 //===========================================
 
 //= NAMESPACES ================
@@ -60,6 +61,8 @@ namespace Directus
 	{
 		m_skybox = nullptr;
 		m_camera = nullptr;
+		m_culledFrustrum = nullptr;
+		m_culledFrustrumVersion = 0;
 		m_texEnvironment = nullptr;
 		m_lineRenderer = nullptr;
 		m_nearPlane = 0.0f;
@@ -304,6 +307,12 @@ namespace Directus
 		m_renderables.clear();
 		m_renderables.shrink_to_fit();
 
+		// The renderables changed, so must the bounds
+		m_boundsLocal.clear();
+		m_boundsTransformVersion.clear();
+		m_rejectingPlane.clear();
+		m_culledFrustrum = nullptr;
+
 		m_lights.clear();
 		m_lights.shrink_to_fit();
 
@@ -313,6 +322,24 @@ namespace Directus
 		m_camera = nullptr;
 	}
 
+	size_t Renderer::GetMemoryUsageGPU()
+	{
+		size_t size = m_GBuffer ? m_GBuffer->GetMemoryUsage() : 0;
+		size += m_renderTexPing ? m_renderTexPing->GetMemoryUsage() : 0;
+		size += m_renderTexPong ? m_renderTexPong->GetMemoryUsage() : 0;
+
+		if (m_directionalLight)
+		{
+			for (int i = 0; i < m_directionalLight->GetShadowCascadeCount(); i++)
+			{
+				auto cascade = m_directionalLight->GetShadowCascade(i).lock();
+				size += cascade ? cascade->GetMemoryUsage() : 0;
+			}
+		}
+
+		return size;
+	}
+
 	void Renderer::AcquireRenderables(Variant renderables)
 	{
 		Clear();
@@ -413,11 +440,201 @@ namespace Directus
 		}
 	}
 
+	void Renderer::CullRenderables()
+	{
+		int count = (int)m_renderables.size();
+		m_boundsCenterX.resize(count); m_boundsCenterY.resize(count); m_boundsCenterZ.resize(count);
+		m_boundsExtentX.resize(count); m_boundsExtentY.resize(count); m_boundsExtentZ.resize(count);
+		m_boundsRadius.resize(count);
+		m_boundsOriented.resize(count);
+		m_boundsUseOriented.resize(count);
+		m_rejectingPlane.resize(count, 0);
+		m_boundsLocal.resize(count);
+		m_boundsTransformVersion.resize(count, 0); // 0 is never a valid version
+
+		// Find the bounds which have to be re-computed
+		m_dirtyIndices.clear();
+		m_dirtyCenters.clear();
+		m_dirtyExtents.clear();
+		m_dirtyTransforms.clear();
+		for (int i = 0; i < count; i++)
+		{
+			GameObject* gameObj = m_renderables[i]._Get();
+			MeshFilter* meshFilter = gameObj ? gameObj->GetMeshFilter() : nullptr;
+			if (!meshFilter)
+			{
+				// Nothing to render, it will be skipped during the pass anyway
+				m_boundsCenterX[i] = m_boundsCenterY[i] = m_boundsCenterZ[i] = 0.0f;
+				m_boundsExtentX[i] = m_boundsExtentY[i] = m_boundsExtentZ[i] = 0.0f;
+				m_boundsRadius[i] = 0.0f;
+				m_boundsUseOriented[i] = false;
+				m_boundsTransformVersion[i] = 0;
+				continue;
+			}
+
+			Transform* transform = gameObj->GetTransform();
+			BoundingBox box = meshFilter->GetBoundingBox();
+			if (m_boundsTransformVersion[i] == transform->GetVersion() && m_boundsLocal[i].min == box.min && m_boundsLocal[i].max == box.max)
+				continue;
+
+			const Matrix& world = transform->GetWorldTransform();
+			m_boundsLocal[i] = box;
+			m_boundsTransformVersion[i] = transform->GetVersion();
+			m_boundsRadius[i] = meshFilter->GetBoundingSphere().Transformed(world).radius;
+			m_boundsOriented[i] = OrientedBoundingBox(box, world);
+			m_dirtyIndices.push_back(i);
+			m_dirtyCenters.push_back(box.GetCenter());
+			m_dirtyExtents.push_back(box.GetHalfSize());
+			m_dirtyTransforms.push_back(&world);
+		}
+
+		// Re-compute them in one go and scatter them back
+		int dirtyCount = (int)m_dirtyIndices.size();
+		if (dirtyCount > 0)
+		{
+			m_dirtyBounds.resize(dirtyCount * 6);
+			float* bounds = m_dirtyBounds.data();
+			BoundingBox::TransformBatch(
+				m_dirtyCenters.data(), m_dirtyExtents.data(), m_dirtyTransforms.data(), dirtyCount,
+				bounds, bounds + dirtyCount, bounds + dirtyCount * 2,
+				bounds + dirtyCount * 3, bounds + dirtyCount * 4, bounds + dirtyCount * 5
+			);
+
+			for (int j = 0; j < dirtyCount; j++)
+			{
+				int i = m_dirtyIndices[j];
+				m_boundsCenterX[i] = bounds[j];
+				m_boundsCenterY[i] = bounds[dirtyCount + j];
+				m_boundsCenterZ[i] = bounds[dirtyCount * 2 + j];
+				m_boundsExtentX[i] = bounds[dirtyCount * 3 + j];
+				m_boundsExtentY[i] = bounds[dirtyCount * 4 + j];
+				m_boundsExtentZ[i] = bounds[dirtyCount * 5 + j];
+
+				// Long rotated meshes get a world box far bigger than they are, test those with their oriented box
+				float volume = 8.0f * m_boundsExtentX[i] * m_boundsExtentY[i] * m_boundsExtentZ[i];
+				m_boundsUseOriented[i] = m_boundsOriented[i].GetVolume() * 2.0f < volume;
+			}
+		}
+
+		Frustrum* frustrum = m_camera->GetFrustrum();
+		bool frustrumChanged =
+			frustrum != m_culledFrustrum ||
+			frustrum->GetVersion() != m_culledFrustrumVersion ||
+			m_visibility.size() != (count + 31) / 32;
+
+		// Nothing but a few renderables moved, so only those have to be tested again.
+		// With a static camera and scene, culling costs next to nothing.
+		if (!frustrumChanged)
+		{
+			for (int i : m_dirtyIndices)
+			{
+				if (IsRenderableVisible(frustrum, i, false))
+				{
+					m_visibility[i >> 5] |= 1u << (i & 31);
+				}
+				else
+				{
+					m_visibility[i >> 5] &= ~(1u << (i & 31));
+				}
+			}
+			return;
+		}
+
+		// Test the spheres all at once, instead of once per shader/material iteration
+		frustrum->CheckSpheres(
+			m_boundsCenterX.data(), m_boundsCenterY.data(), m_boundsCenterZ.data(), m_boundsRadius.data(),
+			count, m_visibility, m_intersecting
+		);
+
+		// Only the spheres which cross a plane need the tighter box test. Oriented boxes are
+		// tested one by one, world boxes are gathered and tested all at once.
+		m_refineIndices.clear();
+		for (int word = 0; word < (int)m_intersecting.size(); word++)
+		{
+			unsigned int bits = m_intersecting[word];
+			for (int bit = 0; bits != 0; bit++, bits >>= 1)
+			{
+				if (!(bits & 1))
+					continue;
+
+				int i = word * 32 + bit;
+				if (!m_boundsUseOriented[i])
+				{
+					m_refineIndices.push_back(i);
+				}
+				else if (!IsRenderableVisible(frustrum, i, true))
+				{
+					m_visibility[word] &= ~(1u << bit);
+				}
+			}
+		}
+
+		int refineCount = (int)m_refineIndices.size();
+		if (refineCount > 0)
+		{
+			m_refineBounds.resize(refineCount * 6);
+			float* bounds = m_refineBounds.data();
+			for (int j = 0; j < refineCount; j++)
+			{
+				int i = m_refineIndices[j];
+				bounds[j] = m_boundsCenterX[i];
+				bounds[refineCount + j] = m_boundsCenterY[i];
+				bounds[refineCount * 2 + j] = m_boundsCenterZ[i];
+				bounds[refineCount * 3 + j] = m_boundsExtentX[i];
+				bounds[refineCount * 4 + j] = m_boundsExtentY[i];
+				bounds[refineCount * 5 + j] = m_boundsExtentZ[i];
+			}
+
+			frustrum->CheckCubes(
+				bounds, bounds + refineCount, bounds + refineCount * 2,
+				bounds + refineCount * 3, bounds + refineCount * 4, bounds + refineCount * 5,
+				refineCount, m_refineVisibility
+			);
+
+			for (int j = 0; j < refineCount; j++)
+			{
+				if (!Frustrum::IsVisible(m_refineVisibility, j))
+				{
+					int i = m_refineIndices[j];
+					m_visibility[i >> 5] &= ~(1u << (i & 31));
+				}
+			}
+		}
+
+		m_culledFrustrum = frustrum;
+		m_culledFrustrumVersion = frustrum->GetVersion();
+	}
+
+	bool Renderer::IsRenderableVisible(Frustrum* frustrum, int index, bool sphereTested)
+	{
+		int& planeHint = m_rejectingPlane[index];
+
+		if (!sphereTested)
+		{
+			Vector3 center = Vector3(m_boundsCenterX[index], m_boundsCenterY[index], m_boundsCenterZ[index]);
+			Intersection result = frustrum->CheckSphere(center, m_boundsRadius[index], planeHint);
+			if (result != Intersects)
+				return result == Inside;
+		}
+
+		Intersection result = m_boundsUseOriented[index] ?
+			frustrum->CheckOrientedBox(m_boundsOriented[index], planeHint) :
+			frustrum->CheckCube(
+				Vector3(m_boundsCenterX[index], m_boundsCenterY[index], m_boundsCenterZ[index]),
+				Vector3(m_boundsExtentX[index], m_boundsExtentY[index], m_boundsExtentZ[index]),
+				planeHint
+			);
+
+		return result != Outside;
+	}
+
 	void Renderer::GBufferPass()
 	{
 		if (!m_graphics)
 			return;
 
+		CullRenderables();
+
 		m_GBuffer->SetAsRenderTarget();
 		m_graphics->SetViewport();
 		m_GBuffer->Clear();
@@ -471,11 +688,16 @@ namespace Directus
 				shader._Get()->UpdateTextures(m_textures);
 				//==================================================================================
 
-				for (const auto& gameObj : m_renderables) // GAMEOBJECT/MESH ITERATION
+				for (int i = 0; i < (int)m_renderables.size(); i++) // GAMEOBJECT/MESH ITERATION
 				{
+					const auto& gameObj = m_renderables[i];
 					if (gameObj.expired())
 						continue;
 
+					// skip objects outside of the view frustrum
+					if (!Frustrum::IsVisible(m_visibility, i))
+						continue;
+
 					//= Get all that we need =========================================
 					MeshFilter* meshFilter = gameObj._Get()->GetMeshFilter();
 					MeshRenderer* meshRenderer = gameObj._Get()->GetMeshRenderer();
@@ -496,10 +718,6 @@ namespace Directus
 					if (objMaterial->GetOpacity() < 1.0f)
 						continue;
 
-					// skip objects outside of the view frustrum
-					if (!m_camera->IsInViewFrustrum(meshFilter))
-						continue;
-
 					// UPDATE PER OBJECT BUFFER
 					shader._Get()->UpdatePerObjectBuffer(mWorld, mView, mProjection, meshRenderer->GetReceiveShadows());
 
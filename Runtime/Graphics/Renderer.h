@@ -27,6 +27,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "D3D11/D3D11GraphicsDevice.h"
 #include "../Core/SubSystem.h"
 #include "../Math/Matrix.h"
+#include "../Math/BoundingBox.h"
+#include "../Math/OrientedBoundingBox.h"
 #include "../Resource/ResourceManager.h"
 #include "../Core/Settings.h"
 //======================================
@@ -96,10 +98,15 @@ namespace Directus
 		void Clear();
 		const std::vector<weakGameObj>& GetRenderables() { return m_renderables; }
 
+		// Video memory used by the render targets (G-Buffer, post-processing and shadow maps)
+		size_t GetMemoryUsageGPU();
+
 	private:
 		//= HELPER FUNCTIONS ========================
 		void AcquireRenderables(Variant renderables);
 		void DirectionalLightDepthPass();
+		void CullRenderables();
+		bool IsRenderableVisible(Math::Frustrum* frustrum, int index, bool sphereTested);
 		void GBufferPass();
 		void DeferredPass();
 		void PostProcessing();
@@ -115,6 +122,36 @@ namespace Directus
 		Light* m_directionalLight;
 		//=====================================
 
+		//= CULLING ==========================================
+		// World space bounds of the renderables (SoA) and their visibility bits. The bounding
+		// spheres share their center with the boxes, so only their radius is kept.
+		std::vector<float> m_boundsCenterX, m_boundsCenterY, m_boundsCenterZ;
+		std::vector<float> m_boundsExtentX, m_boundsExtentY, m_boundsExtentZ;
+		std::vector<float> m_boundsRadius;
+		std::vector<unsigned int> m_visibility;
+		std::vector<unsigned int> m_intersecting;
+		// Oriented boxes, used instead of the world box when that is far too loose
+		std::vector<Math::OrientedBoundingBox> m_boundsOriented;
+		std::vector<bool> m_boundsUseOriented;
+		// The plane which rejected each renderable last, tested first next time
+		std::vector<int> m_rejectingPlane;
+		// The frustum the visibility bits are for, when it doesn't change only moved renderables are tested again
+		Math::Frustrum* m_culledFrustrum;
+		unsigned int m_culledFrustrumVersion;
+		// What the world bounds were computed from, to only re-compute what changed
+		std::vector<Math::BoundingBox> m_boundsLocal;
+		std::vector<unsigned int> m_boundsTransformVersion;
+		// Scratch space for the bounds that have to be re-computed
+		std::vector<int> m_dirtyIndices;
+		std::vector<Math::Vector3> m_dirtyCenters, m_dirtyExtents;
+		std::vector<const Math::Matrix*> m_dirtyTransforms;
+		std::vector<float> m_dirtyBounds;
+		// Scratch space for the world boxes whose sphere crosses a plane
+		std::vector<int> m_refineIndices;
+		std::vector<float> m_refineBounds;
+		std::vector<unsigned int> m_refineVisibility;
+		//====================================================
+
 		//= RENDER TEXTURES ================================
 		std::unique_ptr<D3D11RenderTexture> m_renderTexPing;
 		std::unique_ptr<D3D11RenderTexture> m_renderTexPong;
@@ -31,9 +31,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Core/Helper.h"
 #include "../Resource/Import/ImageImporter.h"
 #include "../Resource/Import/DDSTextureImporter.h"
+#include "../Resource/Import/TextureCooker.h"
 #include "../Resource/ResourceManager.h"
 #include "D3D11/D3D11Texture.h"
 #include "../IO/XmlDocument.h"
+#include "../IO/StreamIO.h"
 //================================================
 
 //= NAMESPACES =====
@@ -116,6 +118,89 @@ namespace Directus
 		bool engineFormat = FileSystem::GetExtensionFromFilePath(filePath) == METADATA_EXTENSION;
 		return engineFormat ? LoadMetadata(filePath) : LoadFromForeignFormat(filePath);
 	}
+
+	bool Texture::Decode(const string& filePath)
+	{
+		// DDS and metadata files are loaded by Commit()
+		string extension = FileSystem::GetExtensionFromFilePath(filePath);
+		if (extension == METADATA_EXTENSION || extension == ".dds")
+			return true;
+
+		// An unchanged texture loads the artefact of its last import instead of decoding
+		auto importCache = m_context->GetSubsystem<ResourceManager>()->GetImportCache();
+		string key = TextureCooker::ComputeKey(importCache._Get(), filePath, m_generateMipmaps);
+		string artefact = importCache._Get()->Find(filePath, key);
+		if (!artefact.empty() && LoadCooked(artefact))
+		{
+			importCache._Get()->Record(filePath, key, artefact);
+			return true;
+		}
+
+		// Each texture decodes with its own importer, so that they can decode in parallel
+		m_decodedImage = make_unique<ImageImporter>();
+		if (!m_decodedImage->Load(filePath, m_generateMipmaps))
+		{
+			LOG_WARNING("Failed to load texture \"" + filePath + "\".");
+			m_decodedImage.reset();
+			return false;
+		}
+
+		artefact = importCache._Get()->GetArtefactFilePath(key, TEXTURE_EXTENSION);
+		if (TextureCooker::Save(artefact, m_decodedImage.get(), m_generateMipmaps))
+		{
+			importCache._Get()->Record(filePath, key, artefact);
+		}
+
+		return true;
+	}
+
+	bool Texture::Commit(const string& filePath)
+	{
+		if (!m_cookedMips.empty())
+		{
+			SetResourceFilePath(filePath);
+			return CreateFromCooked();
+		}
+
+		if (!m_decodedImage)
+			return LoadFromFile(filePath);
+
+		bool created = CreateFromImporter(m_decodedImage.get());
+		m_decodedImage.reset();
+
+		return created;
+	}
+
+	size_t Texture::GetMemoryUsageCPU()
+	{
+		// Pixels are only kept while an import waits to be committed
+		size_t size = 0;
+		if (m_decodedImage)
+		{
+			size += (size_t)m_decodedImage->GetWidth() * m_decodedImage->GetHeight() * 4;
+			for (const auto& mip : m_decodedImage->GetRGBAMipChain())
+			{
+				size += mip.size();
+			}
+		}
+
+		for (const auto& mip : m_cookedMips)
+		{
+			size += mip.size();
+		}
+
+		return size;
+	}
+
+	size_t Texture::GetMemoryUsageGPU()
+	{
+		if (!m_texture || !m_texture->GetShaderResourceView())
+			return 0;
+
+		// Textures are created as RGBA 8, a full mip chain adds a third
+		size_t size = (size_t)m_width * m_height * 4;
+		return m_generateMipmaps ? size + size / 3 : size;
+	}
 	//==============================================================================================
 
 	void Texture::SetTextureType(TextureType type)
@@ -202,34 +287,30 @@ namespace Directus
 		}
 
 		// Load texture
-		auto imageImp = m_context->GetSubsystem<ResourceManager>()->GetImageImporter();
-		bool loaded = imageImp._Get()->Load(filePath, m_generateMipmaps);
-		if (!loaded)
-		{
-			LOG_WARNING("Failed to load texture \"" + filePath + "\".");
-			imageImp._Get()->Clear();
+		if (!Decode(filePath))
 			return false;
-		}
 
+		return Commit(filePath);
+	}
+
+	bool Texture::CreateFromImporter(ImageImporter* imageImp)
+	{
 		// Extract any metadata we can from the ImageImporter
-		SetResourceFilePath(imageImp._Get()->GetPath());
+		SetResourceFilePath(imageImp->GetPath());
 		SetResourceName(FileSystem::GetFileNameNoExtensionFromFilePath(GetResourceFilePath()));
-		m_grayscale = imageImp._Get()->IsGrayscale();
-		m_transparency = imageImp._Get()->IsTransparent();
+		m_grayscale = imageImp->IsGrayscale();
+		m_transparency = imageImp->IsTransparent();
 
 		// Create the texture
 		if (!m_generateMipmaps)
 		{
-			CreateFromMemory(imageImp._Get()->GetWidth(), imageImp._Get()->GetHeight(), imageImp._Get()->GetChannels(), imageImp._Get()->GetRGBA(), RGBA_8_UNORM);
+			CreateFromMemory(imageImp->GetWidth(), imageImp->GetHeight(), imageImp->GetChannels(), imageImp->GetRGBA(), RGBA_8_UNORM);
 		}
 		else
 		{
-			CreateFromMemory(imageImp._Get()->GetWidth(), imageImp._Get()->GetHeight(), imageImp._Get()->GetChannels(), imageImp._Get()->GetRGBAMipChain(), RGBA_8_UNORM);
+			CreateFromMemory(imageImp->GetWidth(), imageImp->GetHeight(), imageImp->GetChannels(), imageImp->GetRGBAMipChain(), RGBA_8_UNORM);
 		}
 
-		// Free any memory allocated by the ImageImporter
-		imageImp._Get()->Clear();
-
 		// Save metadata file
 		if (!SaveToFile(GetResourceFilePath() + METADATA_EXTENSION))
 			return false;
@@ -237,6 +318,52 @@ namespace Directus
 		return true;
 	}
 
+	bool Texture::CreateFromCooked()
+	{
+		SetResourceName(FileSystem::GetFileNameNoExtensionFromFilePath(GetResourceFilePath()));
+
+		bool created = m_generateMipmaps ?
+			CreateFromMemory(m_width, m_height, m_channels, m_cookedMips, RGBA_8_UNORM) :
+			CreateFromMemory(m_width, m_height, m_channels, m_cookedMips.front().data(), RGBA_8_UNORM);
+		m_cookedMips.clear();
+
+		// The import that cooked the texture saved the metadata, unless it was cooked offline
+		if (!FileSystem::FileExists(GetResourceFilePath() + METADATA_EXTENSION))
+		{
+			SaveToFile(GetResourceFilePath() + METADATA_EXTENSION);
+		}
+
+		return created;
+	}
+
+	bool Texture::LoadCooked(const string& filePath)
+	{
+		StreamIO stream(filePath, Stream_Read);
+		if (!stream.IsOpen())
+			return false;
+
+		m_width = stream.ReadInt();
+		m_height = stream.ReadInt();
+		m_channels = stream.ReadInt();
+		m_grayscale = stream.ReadBool();
+		m_transparency = stream.ReadBool();
+
+		int mipCount = stream.ReadInt();
+		m_cookedMips.clear();
+		for (int i = 0; i < mipCount; i++)
+		{
+			m_cookedMips.push_back(stream.ReadVectorUChar());
+		}
+
+		if (stream.HasError())
+		{
+			m_cookedMips.clear();
+			m_cookedMips.shrink_to_fit();
+		}
+
+		return !m_cookedMips.empty();
+	}
+
 	bool Texture::LoadMetadata(const string& filePath)
 	{
 		if (!XmlDocument::Load(filePath))
@@ -24,11 +24,13 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 //= INCLUDES ====================
 #include "../Resource/Resource.h"
 #include <memory>
+#include <vector>
 //===============================
 
 namespace Directus
 {
 	class D3D11Texture;
+	class ImageImporter;
 
 	enum TextureType
 	{
@@ -61,6 +63,10 @@ namespace Directus
 		//= RESOURCE INTERFACE ========================
 		bool SaveToFile(const std::string& filePath);
 		bool LoadFromFile(const std::string& filePath);
+		bool Decode(const std::string& filePath);
+		bool Commit(const std::string& filePath);
+		size_t GetMemoryUsageCPU();
+		size_t GetMemoryUsageGPU();
 		//=============================================
 
 		//= PROPERTIES ============================================================
@@ -89,6 +95,9 @@ namespace Directus
 
 	private:
 		bool LoadFromForeignFormat(const std::string& filePath);
+		bool CreateFromImporter(ImageImporter* imageImp);
+		bool CreateFromCooked();
+		bool LoadCooked(const std::string& filePath);
 		bool LoadMetadata(const std::string& filePath);
 		TextureType TextureTypeFromString(const std::string& type);
 		int ToAPIFormat(TextureFormat format);
@@ -102,5 +111,12 @@ namespace Directus
 		bool m_alphaIsTransparency;
 		bool m_generateMipmaps;
 		std::unique_ptr<D3D11Texture> m_texture;
+		// Image decoded by Decode(), waiting to be committed
+		std::unique_ptr<ImageImporter> m_decodedImage;
+		// Mip chain of an unchanged texture, read from its import cache artefact
+		std::vector<std::vector<unsigned char>> m_cookedMips;
 	};
+
+	template <>
+	inline ResourceType ToResourceType<Texture>() { return Texture_Resource; }
 }
\ No newline at end of file
@@ -27,6 +27,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Math/Vector4.h"
 //==========================
 
+// Bump when VertexPosTexTBN or the way meshes store it changes, along with MODEL_FILE_VERSION
+#define VERTEX_LAYOUT_VERSION 2
+
 namespace Directus
 {
 	struct VertexPosTexTBN
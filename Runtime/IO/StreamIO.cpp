@@ -21,12 +21,14 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 //= INCLUDES ===================
 #include "StreamIO.h"
-#include <fstream>
-#include "../Core/GameObject.h"
+#include <cstring>
+#include <cstdint>
 #include "../Math/Vector2.h"
 #include "../Math/Vector3.h"
 #include "../Math/Vector4.h"
 #include "../Math/Quaternion.h"
+#include "../FileSystem/AssetArchive.h"
+#include "../FileSystem/MappedFile.h"
 //=============================
 
 //= NAMESPACES ================
@@ -34,156 +36,252 @@ using namespace std;
 using namespace Directus::Math;
 //=============================
 
-//= STREAMS =
-ofstream out;
-ifstream in;
-//===========
+// Large enough that a typical scene or mesh is a handful of system calls
+#define STREAM_BUFFER_SIZE 262144
 
 namespace Directus
 {
-
-	bool StreamIO::StartWriting(const string& path)
+	StreamIO::StreamIO(const string& path, StreamMode mode)
 	{
-		out.open(path, ios::out | ios::binary);
-		return !out.fail();
-	}
+		m_mode = mode;
+		m_file = nullptr;
+		m_isOpen = false;
+		m_hasError = false;
+		m_data = nullptr;
+		m_dataSize = 0;
+		m_position = 0;
+		m_fileSize = 0;
+		m_fileRemaining = 0;
+		m_written = 0;
+
+		if (mode == Stream_Write)
+		{
+			m_file = fopen(path.c_str(), "wb");
+			if (!m_file)
+				return;
+
+			// We do our own buffering
+			setvbuf(m_file, nullptr, _IONBF, 0);
+			m_buffer.reserve(STREAM_BUFFER_SIZE);
+			m_isOpen = true;
+			return;
+		}
 
-	void StreamIO::StopWriting()
-	{
-		out.flush();
-		out.close();
+		// Mounted archives come first, they are read in place
+		size_t size = 0;
+		if (const unsigned char* data = AssetArchive::GetArchivedData(path, size, m_buffer, &m_mapping))
+		{
+			m_data = data;
+			m_dataSize = size;
+			m_fileSize = size;
+			m_isOpen = true;
+			return;
+		}
+
+		// Files that can't be mapped, like empty ones, are simply read
+		if (mode == Stream_ReadMapped)
+		{
+			auto mapping = make_shared<MappedFile>();
+			if (mapping->Open(path))
+			{
+				m_mapping = mapping;
+				m_data = mapping->GetData();
+				m_dataSize = mapping->GetSize();
+				m_fileSize = m_dataSize;
+				m_isOpen = true;
+				return;
+			}
+		}
+
+		m_file = fopen(path.c_str(), "rb");
+		if (!m_file)
+			return;
+
+		setvbuf(m_file, nullptr, _IONBF, 0);
+		fseek(m_file, 0, SEEK_END);
+		long fileSize = ftell(m_file);
+		fseek(m_file, 0, SEEK_SET);
+		if (fileSize < 0)
+		{
+			fclose(m_file);
+			m_file = nullptr;
+			return;
+		}
+
+		m_fileSize = (unsigned long long)fileSize;
+		m_fileRemaining = m_fileSize;
+		m_buffer.resize(STREAM_BUFFER_SIZE);
+		m_isOpen = true;
 	}
 
-	bool StreamIO::StartReading(const string& path)
+	StreamIO::~StreamIO()
 	{
-		in.open(path, ios::in | ios::binary);
-		return !in.fail();
+		Close();
 	}
 
-	void StreamIO::StopReading()
+	bool StreamIO::Close()
 	{
-		in.clear();
-		in.close();
+		if (m_mode == Stream_Write && m_isOpen)
+		{
+			Flush();
+		}
+
+		if (m_file)
+		{
+			if (fclose(m_file) != 0 && m_mode == Stream_Write)
+			{
+				m_hasError = true;
+			}
+			m_file = nullptr;
+		}
+
+		m_isOpen = false;
+		m_mapping.reset();
+		m_data = nullptr;
+		m_dataSize = 0;
+		m_position = 0;
+		m_fileSize = 0;
+		m_fileRemaining = 0;
+
+		return !m_hasError;
 	}
 
+	//= WRITING ============================================================================
 	void StreamIO::WriteBool(bool value)
 	{
-		out.write(reinterpret_cast<char*>(&value), sizeof(value));
+		Write(&value, sizeof(value));
 	}
 
-	void StreamIO::WriteSTR(string value)
+	void StreamIO::WriteSTR(const string& value)
 	{
-		int stringSize = value.size();
-		out.write(reinterpret_cast<char*>(&stringSize), sizeof(stringSize));
-		out.write(const_cast<char*>(value.c_str()), stringSize);
+		int stringSize = (int)value.size();
+		Write(&stringSize, sizeof(stringSize));
+		Write(value.data(), stringSize);
 	}
 
 	void StreamIO::WriteInt(int value)
 	{
-		out.write(reinterpret_cast<char*>(&value), sizeof(value));
+		Write(&value, sizeof(value));
 	}
 
 	void StreamIO::WriteUnsignedInt(unsigned int value)
 	{
-		out.write(reinterpret_cast<char*>(&value), sizeof(value));
+		Write(&value, sizeof(value));
 	}
 
 	void StreamIO::WriteULong(unsigned long value)
 	{
-		out.write(reinterpret_cast<char*>(&value), sizeof(value));
+		// Always 4 bytes, so files are the same on every platform
+		WriteUnsignedInt((unsigned int)value);
+	}
+
+	void StreamIO::WriteULongLong(unsigned long long value)
+	{
+		Write(&value, sizeof(value));
 	}
 
 	void StreamIO::WriteFloat(float value)
 	{
-		out.write(reinterpret_cast<char*>(&value), sizeof(value));
+		Write(&value, sizeof(value));
 	}
 
-	void StreamIO::WriteVectorSTR(vector<string>& vector)
+	void StreamIO::WriteVectorSTR(const vector<string>& vector)
 	{
 		WriteInt(int(vector.size()));
-		for (auto i = 0; i < vector.size(); i++)
+		for (const auto& str : vector)
 		{
-			WriteSTR(vector[i]);
+			WriteSTR(str);
 		}
 	}
 
-	void StreamIO::WriteVector2(Vector2& vector)
+	void StreamIO::WriteVectorUChar(const vector<unsigned char>& vector)
+	{
+		WriteUnsignedInt((unsigned int)vector.size());
+		Write(vector.data(), vector.size());
+	}
+
+	void StreamIO::WriteVector2(const Vector2& vector)
 	{
-		out.write(reinterpret_cast<char*>(&vector.x), sizeof(vector.x));
-		out.write(reinterpret_cast<char*>(&vector.y), sizeof(vector.y));
+		const float values[2] = { vector.x, vector.y };
+		Write(values, sizeof(values));
 	}
 
-	void StreamIO::WriteVector3(Vector3& vector)
+	void StreamIO::WriteVector3(const Vector3& vector)
 	{
-		out.write(reinterpret_cast<char*>(&vector.x), sizeof(vector.x));
-		out.write(reinterpret_cast<char*>(&vector.y), sizeof(vector.y));
-		out.write(reinterpret_cast<char*>(&vector.z), sizeof(vector.z));
+		const float values[3] = { vector.x, vector.y, vector.z };
+		Write(values, sizeof(values));
 	}
 
-	void StreamIO::WriteVector4(Vector4& vector)
+	void StreamIO::WriteVector4(const Vector4& vector)
 	{
-		out.write(reinterpret_cast<char*>(&vector.x), sizeof(vector.x));
-		out.write(reinterpret_cast<char*>(&vector.y), sizeof(vector.y));
-		out.write(reinterpret_cast<char*>(&vector.z), sizeof(vector.z));
-		out.write(reinterpret_cast<char*>(&vector.w), sizeof(vector.w));
+		const float values[4] = { vector.x, vector.y, vector.z, vector.w };
+		Write(values, sizeof(values));
 	}
 
-	void StreamIO::WriteQuaternion(Quaternion& quaternion)
+	void StreamIO::WriteQuaternion(const Quaternion& quaternion)
 	{
-		out.write(reinterpret_cast<char*>(&quaternion.x), sizeof(quaternion.x));
-		out.write(reinterpret_cast<char*>(&quaternion.y), sizeof(quaternion.y));
-		out.write(reinterpret_cast<char*>(&quaternion.z), sizeof(quaternion.z));
-		out.write(reinterpret_cast<char*>(&quaternion.w), sizeof(quaternion.w));
+		const float values[4] = { quaternion.x, quaternion.y, quaternion.z, quaternion.w };
+		Write(values, sizeof(values));
 	}
+	//======================================================================================
 
+	//= READING ============================================================================
 	bool StreamIO::ReadBool()
 	{
-		bool value;
-		in.read(reinterpret_cast<char*>(&value), sizeof(value));
+		bool value = false;
+		Read(&value, sizeof(value));
 
 		return value;
 	}
 
 	string StreamIO::ReadSTR()
 	{
-		int stringSize;
-		in.read(reinterpret_cast<char*>(&stringSize), sizeof(stringSize));
+		int stringSize = ReadInt();
 
 		string value;
+		if (stringSize <= 0)
+			return value;
+
 		value.resize(stringSize);
-		in.read(const_cast<char*>(value.c_str()), stringSize);
+		if (!Read(&value[0], stringSize))
+			value.clear();
 
 		return value;
 	}
 
 	int StreamIO::ReadInt()
 	{
-		int value;
-		in.read(reinterpret_cast<char*>(&value), sizeof(value));
+		int value = 0;
+		Read(&value, sizeof(value));
 
 		return value;
 	}
 
 	unsigned int StreamIO::ReadUnsignedInt()
 	{
-		unsigned int value;
-		in.read(reinterpret_cast<char*>(&value), sizeof(value));
+		unsigned int value = 0;
+		Read(&value, sizeof(value));
 
 		return value;
 	}
 
 	unsigned long StreamIO::ReadULong()
 	{
-		unsigned int value;
-		in.read(reinterpret_cast<char*>(&value), sizeof(value));
+		return ReadUnsignedInt();
+	}
+
+	unsigned long long StreamIO::ReadULongLong()
+	{
+		unsigned long long value = 0;
+		Read(&value, sizeof(value));
 
 		return value;
 	}
 
 	float StreamIO::ReadFloat()
 	{
-		float value;
-		in.read(reinterpret_cast<char*>(&value), sizeof(value));
+		float value = 0.0f;
+		Read(&value, sizeof(value));
 
 		return value;
 	}
@@ -192,51 +290,225 @@ namespace Directus
 	{
 		vector<string> vector;
 
-		int textureIDsCount = ReadInt();
-		for (int i = 0; i < textureIDsCount; i++)
+		int count = ReadInt();
+		for (int i = 0; i < count && !m_hasError; i++)
+		{
 			vector.push_back(ReadSTR());
+		}
 
 		return vector;
 	}
 
-	Vector2 StreamIO::ReadVector2()
+	vector<unsigned char> StreamIO::ReadVectorUChar()
 	{
-		Vector2 vector;
-		in.read(reinterpret_cast<char*>(&vector.x), sizeof(vector.x));
-		in.read(reinterpret_cast<char*>(&vector.y), sizeof(vector.y));
+		vector<unsigned char> vector;
+
+		unsigned int size = ReadUnsignedInt();
+		if (size == 0)
+			return vector;
+
+		vector.resize(size);
+		if (!Read(vector.data(), size))
+			vector.clear();
 
 		return vector;
 	}
 
+	Vector2 StreamIO::ReadVector2()
+	{
+		float values[2] = { 0.0f };
+		Read(values, sizeof(values));
+
+		return Vector2(values[0], values[1]);
+	}
+
 	Vector3 StreamIO::ReadVector3()
 	{
-		Vector3 vector;
-		in.read(reinterpret_cast<char*>(&vector.x), sizeof(vector.x));
-		in.read(reinterpret_cast<char*>(&vector.y), sizeof(vector.y));
-		in.read(reinterpret_cast<char*>(&vector.z), sizeof(vector.z));
+		float values[3] = { 0.0f };
+		Read(values, sizeof(values));
 
-		return vector;
+		return Vector3(values[0], values[1], values[2]);
 	}
 
 	Vector4 StreamIO::ReadVector4()
 	{
-		Vector4 vector;
-		in.read(reinterpret_cast<char*>(&vector.x), sizeof(vector.x));
-		in.read(reinterpret_cast<char*>(&vector.y), sizeof(vector.y));
-		in.read(reinterpret_cast<char*>(&vector.z), sizeof(vector.z));
-		in.read(reinterpret_cast<char*>(&vector.w), sizeof(vector.w));
+		float values[4] = { 0.0f };
+		Read(values, sizeof(values));
 
-		return vector;
+		return Vector4(values[0], values[1], values[2], values[3]);
 	}
 
 	Quaternion StreamIO::ReadQuaternion()
 	{
-		Quaternion quaternion = Quaternion(0, 0, 0, 1);
-		in.read(reinterpret_cast<char*>(&quaternion.x), sizeof(quaternion.x));
-		in.read(reinterpret_cast<char*>(&quaternion.y), sizeof(quaternion.y));
-		in.read(reinterpret_cast<char*>(&quaternion.z), sizeof(quaternion.z));
-		in.read(reinterpret_cast<char*>(&quaternion.w), sizeof(quaternion.w));
+		float values[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+		if (!Read(values, sizeof(values)))
+			return Quaternion(0, 0, 0, 1);
+
+		return Quaternion(values[0], values[1], values[2], values[3]);
+	}
+	//======================================================================================
+
+	//= IO =================================================================================
+	void StreamIO::Write(const void* data, size_t size)
+	{
+		if (!m_isOpen || m_mode != Stream_Write || m_hasError || size == 0)
+			return;
+
+		// Small writes are gathered in the buffer
+		if (m_buffer.size() + size <= STREAM_BUFFER_SIZE)
+		{
+			const unsigned char* bytes = static_cast<const unsigned char*>(data);
+			m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+			return;
+		}
+
+		// Large ones go straight to the file, after what's already buffered
+		if (!Flush())
+			return;
+
+		if (size >= STREAM_BUFFER_SIZE)
+		{
+			if (fwrite(data, 1, size, m_file) != size)
+			{
+				m_hasError = true;
+			}
+			m_written += size;
+			return;
+		}
+
+		const unsigned char* bytes = static_cast<const unsigned char*>(data);
+		m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+	}
+
+	bool StreamIO::Read(void* data, size_t size)
+	{
+		if (!m_isOpen || m_mode == Stream_Write || m_hasError)
+		{
+			memset(data, 0, size);
+			return false;
+		}
+
+		unsigned char* destination = static_cast<unsigned char*>(data);
+		size_t buffered = m_dataSize - m_position;
+
+		// Not enough data left, the file is truncated or the size we were given is garbage
+		if (size > buffered + m_fileRemaining)
+		{
+			m_hasError = true;
+			memset(data, 0, size);
+			return false;
+		}
+
+		// Whatever is buffered
+		size_t count = size < buffered ? size : buffered;
+		if (count != 0)
+		{
+			memcpy(destination, m_data + m_position, count);
+			m_position += count;
+			destination += count;
+			size -= count;
+		}
+
+		if (size == 0)
+			return true;
+
+		// The rest comes from the file, directly when it's large, through the buffer otherwise
+		if (size >= STREAM_BUFFER_SIZE)
+		{
+			if (fread(destination, 1, size, m_file) != size)
+			{
+				m_hasError = true;
+				memset(destination, 0, size);
+				return false;
+			}
+			m_fileRemaining -= size;
+			return true;
+		}
+
+		size_t refill = m_fileRemaining < STREAM_BUFFER_SIZE ? (size_t)m_fileRemaining : STREAM_BUFFER_SIZE;
+		if (fread(m_buffer.data(), 1, refill, m_file) != refill)
+		{
+			m_hasError = true;
+			memset(destination, 0, size);
+			return false;
+		}
+		m_fileRemaining -= refill;
+		m_data = m_buffer.data();
+		m_dataSize = refill;
+
+		memcpy(destination, m_data, size);
+		m_position = size;
+
+		return true;
+	}
+
+	unsigned long long StreamIO::GetOffset()
+	{
+		if (m_mode == Stream_Write)
+			return m_written + m_buffer.size();
+
+		return m_fileSize - m_fileRemaining - (m_dataSize - m_position);
+	}
+
+	void StreamIO::WritePadding()
+	{
+		static const unsigned char zeros[STREAM_ARRAY_ALIGNMENT] = { 0 };
+		Write(zeros, (STREAM_ARRAY_ALIGNMENT - GetOffset() % STREAM_ARRAY_ALIGNMENT) % STREAM_ARRAY_ALIGNMENT);
+	}
+
+	void StreamIO::ReadPadding()
+	{
+		unsigned char padding[STREAM_ARRAY_ALIGNMENT];
+		Read(padding, (STREAM_ARRAY_ALIGNMENT - GetOffset() % STREAM_ARRAY_ALIGNMENT) % STREAM_ARRAY_ALIGNMENT);
+	}
+
+	unsigned int StreamIO::ReadArrayHeader(size_t stride, unsigned int layout)
+	{
+		unsigned int count = ReadUnsignedInt();
+		unsigned int storedStride = ReadUnsignedInt();
+		unsigned int storedLayout = ReadUnsignedInt();
+		ReadPadding();
+		if (m_hasError || count == 0)
+			return 0;
+
+		// Checked before anything gets allocated for it
+		unsigned long long size = (unsigned long long)count * stride;
+		if (storedStride != stride || storedLayout != layout || size > (m_dataSize - m_position) + m_fileRemaining)
+		{
+			m_hasError = true;
+			return 0;
+		}
+
+		return count;
+	}
+
+	const unsigned char* StreamIO::View(size_t size, size_t alignment)
+	{
+		// Only mapped data outlives the stream
+		if (!m_mapping || m_hasError || size > m_dataSize - m_position)
+			return nullptr;
+
+		const unsigned char* data = m_data + m_position;
+		if (reinterpret_cast<uintptr_t>(data) % alignment != 0)
+			return nullptr;
+
+		m_position += size;
+		return data;
+	}
+
+	bool StreamIO::Flush()
+	{
+		if (m_buffer.empty())
+			return !m_hasError;
+
+		if (fwrite(m_buffer.data(), 1, m_buffer.size(), m_file) != m_buffer.size())
+		{
+			m_hasError = true;
+		}
+		m_written += m_buffer.size();
+		m_buffer.clear();
 
-		return quaternion;
+		return !m_hasError;
 	}
+	//======================================================================================
 }
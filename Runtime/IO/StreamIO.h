@@ -21,13 +21,22 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #pragma once
 
-//= INCLUDES ====
+//= INCLUDES ===============
 #include <vector>
-//===============
+#include <string>
+#include <cstdio>
+#include <type_traits>
+#include <memory>
+#include "../Core/Helper.h"
+//==========================
+
+// Array blocks start at this file offset alignment, so mapped arrays can be used in place
+#define STREAM_ARRAY_ALIGNMENT 16
 
 namespace Directus
 {
-	class GameObject;
+	class MappedFile;
+
 	namespace Math
 	{
 		class Vector2;
@@ -36,42 +45,155 @@ namespace Directus
 		class Quaternion;
 	}
 
-	class StreamIO
+	enum StreamMode
+	{
+		Stream_Read,
+		// Reads through a memory mapping of the file, so that ViewArray() doesn't copy
+		Stream_ReadMapped,
+		Stream_Write
+	};
+
+	// A binary file stream. Each instance owns its file and a large buffer, so any number of
+	// streams can be open at the same time, on any thread. Reading past the end of the data
+	// or failing to write puts the stream in an error state, after which reads return zeros.
+	class DLL_API StreamIO
 	{
 	public:
-		//= STREAM =======================================
-		static bool StartWriting(const std::string& path);
-		static void StopWriting();
-		static bool StartReading(const std::string& path);
-		static void StopReading();
-		//================================================
-
-		//= WRITING =================================================
-		static void WriteBool(bool value);
-		static void WriteSTR(std::string value);
-		static void WriteInt(int value);
-		static void WriteUnsignedInt(unsigned int value);
-		static void WriteULong(unsigned long value);
-		static void WriteFloat(float value);
-		static void WriteVectorSTR(std::vector<std::string>& vector);
-		static void WriteVector2(Math::Vector2& vector);
-		static void WriteVector3(Math::Vector3& vector);
-		static void WriteVector4(Math::Vector4& vector);
-		static void WriteQuaternion(Math::Quaternion& quaternion);
-		//===========================================================
-
-		//= READING ====================================
-		static bool ReadBool();
-		static std::string ReadSTR();
-		static int ReadInt();
-		static unsigned int ReadUnsignedInt();
-		static unsigned long ReadULong();
-		static float ReadFloat();
-		static std::vector<std::string> ReadVectorSTR();
-		static Math::Vector2 ReadVector2();
-		static Math::Vector3 ReadVector3();
-		static Math::Vector4 ReadVector4();
-		static Math::Quaternion ReadQuaternion();
-		//==============================================
+		StreamIO(const std::string& path, StreamMode mode);
+		~StreamIO();
+
+		bool IsOpen() { return m_isOpen; }
+		bool HasError() { return m_hasError; }
+		// The mapping the stream reads from, if any, holding it keeps viewed arrays valid
+		const std::shared_ptr<MappedFile>& GetMapping() { return m_mapping; }
+		// Writes what's buffered and closes the file, returns false if anything failed
+		bool Close();
+
+		//= WRITING ==========================================
+		void WriteBool(bool value);
+		void WriteSTR(const std::string& value);
+		void WriteInt(int value);
+		void WriteUnsignedInt(unsigned int value);
+		void WriteULong(unsigned long value);
+		void WriteULongLong(unsigned long long value);
+		void WriteFloat(float value);
+		void WriteVectorSTR(const std::vector<std::string>& vector);
+		void WriteVectorUChar(const std::vector<unsigned char>& vector);
+		void WriteVector2(const Math::Vector2& vector);
+		void WriteVector3(const Math::Vector3& vector);
+		void WriteVector4(const Math::Vector4& vector);
+		void WriteQuaternion(const Math::Quaternion& quaternion);
+		//====================================================
+
+		// Writes plain data elements as a single block, after a header with their
+		// count, their size and a layout version that ReadArray() will expect.
+		template <typename T>
+		void WriteArray(const T* data, unsigned int count, unsigned int layout = 0)
+		{
+			static_assert(std::is_standard_layout<T>::value, "StreamIO: Arrays must contain plain data.");
+
+			WriteUnsignedInt(count);
+			WriteUnsignedInt((unsigned int)sizeof(T));
+			WriteUnsignedInt(layout);
+			WritePadding();
+			Write(data, count * sizeof(T));
+		}
+
+		template <typename T>
+		void WriteArray(const std::vector<T>& vector, unsigned int layout = 0) { WriteArray(vector.data(), (unsigned int)vector.size(), layout); }
+
+		//= READING ============================
+		bool ReadBool();
+		std::string ReadSTR();
+		int ReadInt();
+		unsigned int ReadUnsignedInt();
+		unsigned long ReadULong();
+		unsigned long long ReadULongLong();
+		float ReadFloat();
+		std::vector<std::string> ReadVectorSTR();
+		std::vector<unsigned char> ReadVectorUChar();
+		Math::Vector2 ReadVector2();
+		Math::Vector3 ReadVector3();
+		Math::Vector4 ReadVector4();
+		Math::Quaternion ReadQuaternion();
+		// Skips the padding that WriteArray() puts between an array's header and its data
+		void ReadPadding();
+		//======================================
+
+		// Reads what WriteArray() wrote, an array of a different element size
+		// or layout puts the stream in an error state and reads as empty.
+		template <typename T>
+		void ReadArray(std::vector<T>& vector, unsigned int layout = 0)
+		{
+			static_assert(std::is_standard_layout<T>::value, "StreamIO: Arrays must contain plain data.");
+
+			vector.clear();
+			unsigned int count = ReadArrayHeader(sizeof(T), layout);
+			if (count == 0)
+				return;
+
+			vector.resize(count);
+			if (!Read(vector.data(), count * sizeof(T)))
+				vector.clear();
+		}
+
+		// Same as ReadArray() but arrays in mapped memory are returned in place, valid for as long
+		// as GetMapping() is held. Anything else is copied into storage and returned from there.
+		template <typename T>
+		const T* ViewArray(std::vector<T>& storage, unsigned int& count, unsigned int layout = 0)
+		{
+			static_assert(std::is_standard_layout<T>::value, "StreamIO: Arrays must contain plain data.");
+
+			storage.clear();
+			count = ReadArrayHeader(sizeof(T), layout);
+			if (count == 0)
+				return nullptr;
+
+			if (const unsigned char* data = View(count * sizeof(T), alignof(T)))
+				return reinterpret_cast<const T*>(data);
+
+			storage.resize(count);
+			if (!Read(storage.data(), count * sizeof(T)))
+			{
+				storage.clear();
+				count = 0;
+				return nullptr;
+			}
+
+			return storage.data();
+		}
+
+	private:
+		StreamIO(const StreamIO&) = delete;
+		StreamIO& operator=(const StreamIO&) = delete;
+
+		void Write(const void* data, size_t size);
+		bool Read(void* data, size_t size);
+		bool Flush();
+		// Offset in the file of the next byte to be read or written
+		unsigned long long GetOffset();
+		void WritePadding();
+		// Returns the element count, or zero if the header doesn't match or the data is too short
+		unsigned int ReadArrayHeader(size_t stride, unsigned int layout);
+		// Returns the next bytes in place when they are mapped and aligned, nullptr otherwise
+		const unsigned char* View(size_t size, size_t alignment);
+
+		StreamMode m_mode;
+		FILE* m_file;
+		bool m_isOpen;
+		bool m_hasError;
+
+		// Writing appends to the buffer, reading consumes m_data, which is either the
+		// buffer refilled from the file or a mapped or archived file, read in place.
+		std::vector<unsigned char> m_buffer;
+		std::shared_ptr<MappedFile> m_mapping;
+		const unsigned char* m_data;
+		size_t m_dataSize;
+		size_t m_position;
+		unsigned long long m_fileSize;
+		// Bytes of the file that haven't been read into the buffer yet
+		unsigned long long m_fileRemaining;
+		// Bytes written to the file, not counting what's buffered
+		unsigned long long m_written;
 	};
-}
+}
\ No newline at end of file
@@ -27,6 +27,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Math/Vector3.h"
 #include "../Math/Vector4.h"
 #include "../FileSystem/FileSystem.h"
+#include "../FileSystem/AssetArchive.h"
 //==========================
 
 //= NAMESPACES ================
@@ -37,8 +38,8 @@ using namespace Directus::Math;
 
 namespace Directus
 {
-	unique_ptr<xml_document> XmlDocument::m_document;
-	vector<shared_ptr<xml_node>> XmlDocument::m_nodes;
+	thread_local unique_ptr<xml_document> XmlDocument::m_document;
+	thread_local vector<shared_ptr<xml_node>> XmlDocument::m_nodes;
 
 	void XmlDocument::Create()
 	{
@@ -291,7 +292,12 @@ namespace Directus
 	bool XmlDocument::Load(const string& filePath)
 	{
 		m_document = make_unique<xml_document>();
-		xml_parse_result result = m_document->load_file(filePath.c_str());
+
+		// Mounted archives come first
+		size_t size = 0;
+		vector<unsigned char> storage;
+		const unsigned char* data = AssetArchive::GetArchivedData(filePath, size, storage);
+		xml_parse_result result = data ? m_document->load_buffer(data, size) : m_document->load_file(filePath.c_str());
 
 		if (result.status != status_ok)
 		{
@@ -105,7 +105,8 @@ namespace Directus
 		// Returns all the descendant nodes of a node
 		static void GetNodes(pugi::xml_node node);
 
-		static std::unique_ptr<pugi::xml_document> m_document;
-		static std::vector<std::shared_ptr<pugi::xml_node>> m_nodes;
+		// Per thread, so that resources can be (de)serialized by worker threads
+		static thread_local std::unique_ptr<pugi::xml_document> m_document;
+		static thread_local std::vector<std::shared_ptr<pugi::xml_node>> m_nodes;
 	};
 }
@@ -67,7 +67,7 @@ namespace Directus
 		// if a logger is available use it, if not, write to file
 		if (!m_logger.expired())
 		{
-			m_logger._Get()->Log(text, type);
+			m_logger.lock()->Log(text, type);
 		}
 		else
 		{
@@ -85,7 +85,7 @@ namespace Directus
 
 	void Log::Write(weak_ptr<GameObject> gameObject, LogType type)
 	{
-		gameObject.expired() ? Write("Null", type) : Write(gameObject._Get()->GetName(), type);
+		gameObject.expired() ? Write("Null", type) : Write(gameObject.lock()->GetName(), type);
 	}
 
 	void Log::Write(const Vector2& vector, LogType type)
@@ -34,6 +34,7 @@ namespace Directus
 #define LOG_ERROR(text) Log::Write(text, Log::Error)
 
 	class GameObject;
+	class ILogger;
 
 	namespace Math
 	{
@@ -55,7 +55,7 @@ namespace Directus
 			if (mesh.expired())
 				return;
 
-			ComputeFromMesh(mesh._Get());
+			ComputeFromMesh(mesh.lock().get());
 		}
 
 		void BoundingBox::ComputeFromMesh(Mesh* mesh)
@@ -66,7 +66,7 @@ namespace Directus
 			min = Vector3::Infinity;
 			max = Vector3::InfinityNeg;
 
-			auto vertices = mesh->GetVertices();
+			const VertexPosTexTBN* vertices = mesh->GetVertexData();
 			for (unsigned int i = 0; i < mesh->GetVertexCount(); i++)
 			{
 				max.x = Max(max.x, vertices[i].position.x);
@@ -128,6 +128,72 @@ namespace Directus
 			return BoundingBox(newCenter - newEdge, newCenter + newEdge);
 		}
 
+		void BoundingBox::TransformBatch(
+			const Vector3* centers, const Vector3* extents, const Matrix* const* transforms, int count,
+			float* centerX, float* centerY, float* centerZ,
+			float* extentX, float* extentY, float* extentZ
+		)
+		{
+			int i = 0;
+#if defined(MATH_SIMD_SSE)
+			const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+
+			// 4 boxes per iteration, so the results can be transposed and stored as SoA
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 newCenter[4];
+				__m128 newExtent[4];
+				for (int j = 0; j < 4; j++)
+				{
+					// Transpose the columns to get the rows
+					const Matrix& transform = *transforms[i + j];
+					__m128 row0 = _mm_load_ps(&transform.m00);
+					__m128 row1 = _mm_load_ps(&transform.m01);
+					__m128 row2 = _mm_load_ps(&transform.m02);
+					__m128 row3 = _mm_load_ps(&transform.m03);
+					_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+					const Vector3& center = centers[i + j];
+					const Vector3& extent = extents[i + j];
+
+					// center * transform
+					__m128 c = _mm_mul_ps(_mm_set1_ps(center.x), row0);
+					c = _mm_add_ps(c, _mm_mul_ps(_mm_set1_ps(center.y), row1));
+					c = _mm_add_ps(c, _mm_mul_ps(_mm_set1_ps(center.z), row2));
+					newCenter[j] = _mm_add_ps(c, row3);
+
+					// extent * abs(transform)
+					__m128 e = _mm_mul_ps(_mm_set1_ps(extent.x), _mm_and_ps(row0, absMask));
+					e = _mm_add_ps(e, _mm_mul_ps(_mm_set1_ps(extent.y), _mm_and_ps(row1, absMask)));
+					newExtent[j] = _mm_add_ps(e, _mm_mul_ps(_mm_set1_ps(extent.z), _mm_and_ps(row2, absMask)));
+				}
+
+				_MM_TRANSPOSE4_PS(newCenter[0], newCenter[1], newCenter[2], newCenter[3]);
+				_MM_TRANSPOSE4_PS(newExtent[0], newExtent[1], newExtent[2], newExtent[3]);
+				_mm_storeu_ps(centerX + i, newCenter[0]);
+				_mm_storeu_ps(centerY + i, newCenter[1]);
+				_mm_storeu_ps(centerZ + i, newCenter[2]);
+				_mm_storeu_ps(extentX + i, newExtent[0]);
+				_mm_storeu_ps(extentY + i, newExtent[1]);
+				_mm_storeu_ps(extentZ + i, newExtent[2]);
+			}
+#endif
+			// Whatever is left
+			for (; i < count; i++)
+			{
+				const Matrix& transform = *transforms[i];
+				const Vector3& center = centers[i];
+				const Vector3& extent = extents[i];
+
+				centerX[i] = center.x * transform.m00 + center.y * transform.m10 + center.z * transform.m20 + transform.m30;
+				centerY[i] = center.x * transform.m01 + center.y * transform.m11 + center.z * transform.m21 + transform.m31;
+				centerZ[i] = center.x * transform.m02 + center.y * transform.m12 + center.z * transform.m22 + transform.m32;
+				extentX[i] = Abs(transform.m00) * extent.x + Abs(transform.m10) * extent.y + Abs(transform.m20) * extent.z;
+				extentY[i] = Abs(transform.m01) * extent.x + Abs(transform.m11) * extent.y + Abs(transform.m21) * extent.z;
+				extentZ[i] = Abs(transform.m02) * extent.x + Abs(transform.m12) * extent.y + Abs(transform.m22) * extent.z;
+			}
+		}
+
 		void BoundingBox::Merge(const BoundingBox& box)
 		{
 			if (box.min.x < min.x) min.x = box.min.x;
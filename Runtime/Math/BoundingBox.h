@@ -75,6 +75,14 @@ namespace Directus
 			// Returns a transformed bounding box
 			BoundingBox Transformed(const Matrix& transform);
 
+			// Transforms many boxes, given as local centers and extents, by their (affine)
+			// world matrices and writes the world space centers and extents as SoA.
+			static void TransformBatch(
+				const Vector3* centers, const Vector3* extents, const Matrix* const* transforms, int count,
+				float* centerX, float* centerY, float* centerZ,
+				float* extentX, float* extentY, float* extentZ
+			);
+
 			// Merge with another bounding box
 			void Merge(const BoundingBox& box);
 
@@ -0,0 +1,92 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//= INCLUDES ===============
+#include "BoundingSphere.h"
+#include "BoundingBox.h"
+#include "../Graphics/Mesh.h"
+#include "Matrix.h"
+//==========================
+
+namespace Directus
+{
+	namespace Math
+	{
+		BoundingSphere::BoundingSphere()
+		{
+			center = Vector3::Zero;
+			radius = -1.0f;
+		}
+
+		BoundingSphere::BoundingSphere(const Vector3& center, float radius)
+		{
+			this->center = center;
+			this->radius = radius;
+		}
+
+		BoundingSphere::~BoundingSphere()
+		{
+
+		}
+
+		void BoundingSphere::ComputeFromMesh(std::weak_ptr<Mesh> mesh)
+		{
+			Undefine();
+
+			if (mesh.expired())
+				return;
+
+			ComputeFromMesh(mesh.lock().get());
+		}
+
+		void BoundingSphere::ComputeFromMesh(Mesh* mesh)
+		{
+			Undefine();
+
+			if (!mesh || mesh->GetVertexCount() == 0)
+				return;
+
+			center = mesh->GetBoundingBox().GetCenter();
+
+			float radiusSquared = 0.0f;
+			const VertexPosTexTBN* vertices = mesh->GetVertexData();
+			for (unsigned int i = 0; i < mesh->GetVertexCount(); i++)
+			{
+				radiusSquared = Max(radiusSquared, Vector3::LengthSquared(center, vertices[i].position));
+			}
+			radius = Sqrt(radiusSquared);
+		}
+
+		Intersection BoundingSphere::IsInside(const Vector3& point) const
+		{
+			return Vector3::LengthSquared(center, point) <= radius * radius ? Inside : Outside;
+		}
+
+		BoundingSphere BoundingSphere::Transformed(const Matrix& transform) const
+		{
+			float scaleX = Vector3(transform.m00, transform.m01, transform.m02).Length();
+			float scaleY = Vector3(transform.m10, transform.m11, transform.m12).Length();
+			float scaleZ = Vector3(transform.m20, transform.m21, transform.m22).Length();
+
+			return BoundingSphere(transform * center, radius * Max(scaleX, Max(scaleY, scaleZ)));
+		}
+	}
+}
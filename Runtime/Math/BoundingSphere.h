@@ -0,0 +1,66 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+//= INCLUDES ==========
+#include "MathHelper.h"
+#include "Vector3.h"
+#include <memory>
+//=====================
+
+namespace Directus
+{
+	class Mesh;
+	namespace Math
+	{
+		class Matrix;
+
+		class DLL_API BoundingSphere
+		{
+		public:
+			// Construct undefined (negative radius).
+			BoundingSphere();
+
+			// Construct from center and radius.
+			BoundingSphere(const Vector3& center, float radius);
+
+			~BoundingSphere();
+
+			// Computes a sphere centered on the mesh's bounding box which contains all of its vertices.
+			// Sharing the center with the bounding box means that both transform to the same world center.
+			void ComputeFromMesh(std::weak_ptr<Mesh> mesh);
+			void ComputeFromMesh(Mesh* mesh);
+
+			// Test if a point is inside
+			Intersection IsInside(const Vector3& point) const;
+
+			// Returns a transformed sphere, the radius is scaled by the largest axis scale
+			BoundingSphere Transformed(const Matrix& transform) const;
+
+			void Undefine() { center = Vector3::Zero; radius = -1.0f; }
+			bool Defined() const { return radius >= 0.0f; }
+
+			Vector3 center;
+			float radius;
+		};
+	}
+}
@@ -29,7 +29,12 @@ namespace Directus
 	{
 		Frustrum::Frustrum()
 		{
-
+			m_version = 0;
+			for (int i = 0; i < 6; i++)
+			{
+				m_normalX[i] = m_normalY[i] = m_normalZ[i] = m_distance[i] = 0.0f;
+				m_absNormalX[i] = m_absNormalY[i] = m_absNormalZ[i] = 0.0f;
+			}
 		}
 
 		Frustrum::~Frustrum()
@@ -90,29 +95,59 @@ namespace Directus
 			m_planes[5].normal.z = viewProjection.m23 + viewProjection.m21;
 			m_planes[5].d = viewProjection.m33 + viewProjection.m31;
 			m_planes[5].Normalize();
+
+			for (int i = 0; i < 6; i++)
+			{
+				m_normalX[i] = m_planes[i].normal.x;
+				m_normalY[i] = m_planes[i].normal.y;
+				m_normalZ[i] = m_planes[i].normal.z;
+				m_distance[i] = m_planes[i].d;
+				m_absNormalX[i] = Abs(m_normalX[i]);
+				m_absNormalY[i] = Abs(m_normalY[i]);
+				m_absNormalZ[i] = Abs(m_normalZ[i]);
+			}
+
+			m_version++;
 		}
 
 		Intersection Frustrum::CheckCube(const Vector3& center, const Vector3& extent)
+		{
+			int planeHint = 0;
+			return CheckCube(center, extent, planeHint);
+		}
+
+		Intersection Frustrum::CheckSphere(const Vector3& center, float radius)
+		{
+			int planeHint = 0;
+			return CheckSphere(center, radius, planeHint);
+		}
+
+		Intersection Frustrum::CheckOrientedBox(const OrientedBoundingBox& box)
+		{
+			int planeHint = 0;
+			return CheckOrientedBox(box, planeHint);
+		}
+
+		Intersection Frustrum::CheckCube(const Vector3& center, const Vector3& extent, int& planeHint)
 		{
 			// Check if any one point of the cube is in the view frustum.
 			Intersection result = Inside;
-			for (const auto& plane : m_planes)
+			for (int p = 0; p < 6; p++)
 			{
-				Plane absolutePlane = Plane(plane.normal.Absolute(), plane.d);
-
-				float d = center.x * plane.normal.x + center.y * plane.normal.y + center.z * plane.normal.z;
-				float r = extent.x * absolutePlane.normal.x + extent.y * absolutePlane.normal.y + extent.z * absolutePlane.normal.z;
+				int i = (planeHint + p) % 6;
+				float d = center.x * m_normalX[i] + center.y * m_normalY[i] + center.z * m_normalZ[i];
+				float r = extent.x * m_absNormalX[i] + extent.y * m_absNormalY[i] + extent.z * m_absNormalZ[i];
 
 				float d_p_r = d + r;
 				float d_m_r = d - r;
 
-				if (d_p_r < -plane.d)
+				if (d_p_r < -m_distance[i])
 				{
-					result = Outside;
-					break;
+					planeHint = i;
+					return Outside;
 				}
 
-				if (d_m_r < -plane.d)
+				if (d_m_r < -m_distance[i])
 				{
 					result = Intersects;
 				}
@@ -121,29 +156,262 @@ namespace Directus
 			return result;
 		}
 
-		Intersection Frustrum::CheckSphere(const Vector3& center, float radius)
+		Intersection Frustrum::CheckSphere(const Vector3& center, float radius, int& planeHint)
 		{
+			Intersection result = Inside;
+
 			// calculate our distances to each of the planes
-			for (const auto& plane : m_planes)
+			for (int p = 0; p < 6; p++)
 			{
+				int i = (planeHint + p) % 6;
+
 				// find the distance to this plane
-				float fDistance = Vector3::Dot(plane.normal, center) + plane.d;
+				float fDistance = Vector3::Dot(m_planes[i].normal, center) + m_planes[i].d;
 
 				// if this distance is < -sphere.radius, we are outside
 				if (fDistance < -radius)
 				{
+					planeHint = i;
 					return Outside;
 				}
 
-				// else if the distance is between +- radius, then we intersect
+				// else if the distance is between +- radius, then we intersect,
+				// but keep going as one of the remaining planes might reject it
 				if ((float)fabs(fDistance) < radius)
 				{
-					return Intersects;
+					result = Intersects;
+				}
+			}
+
+			return result;
+		}
+
+		Intersection Frustrum::CheckOrientedBox(const OrientedBoundingBox& box, int& planeHint)
+		{
+			Intersection result = Inside;
+			for (int p = 0; p < 6; p++)
+			{
+				int i = (planeHint + p) % 6;
+				const Vector3& normal = m_planes[i].normal;
+
+				// Project the box on the plane normal
+				float d = Vector3::Dot(normal, box.center);
+				float r =
+					box.extents.x * Abs(Vector3::Dot(normal, box.axes[0])) +
+					box.extents.y * Abs(Vector3::Dot(normal, box.axes[1])) +
+					box.extents.z * Abs(Vector3::Dot(normal, box.axes[2]));
+
+				if (d + r < -m_distance[i])
+				{
+					planeHint = i;
+					return Outside;
+				}
+
+				if (d - r < -m_distance[i])
+				{
+					result = Intersects;
+				}
+			}
+
+			return result;
+		}
+
+		void Frustrum::CheckCubes(
+			const float* centerX, const float* centerY, const float* centerZ,
+			const float* extentX, const float* extentY, const float* extentZ,
+			int count, std::vector<unsigned int>& visibility
+		) const
+		{
+			visibility.assign((count + 31) / 32, 0);
+			unsigned int* bits = visibility.data();
+
+			int i = 0;
+#if defined(MATH_SIMD_AVX)
+			{
+				// Broadcast the planes once, instead of once per box
+				__m256 nx[6], ny[6], nz[6], ax[6], ay[6], az[6], dNeg[6];
+				for (int p = 0; p < 6; p++)
+				{
+					nx[p] = _mm256_set1_ps(m_normalX[p]); ny[p] = _mm256_set1_ps(m_normalY[p]); nz[p] = _mm256_set1_ps(m_normalZ[p]);
+					ax[p] = _mm256_set1_ps(m_absNormalX[p]); ay[p] = _mm256_set1_ps(m_absNormalY[p]); az[p] = _mm256_set1_ps(m_absNormalZ[p]);
+					dNeg[p] = _mm256_set1_ps(-m_distance[p]);
+				}
+
+				// 8 boxes per iteration
+				for (; i + 8 <= count; i += 8)
+				{
+					__m256 cx = _mm256_loadu_ps(centerX + i);
+					__m256 cy = _mm256_loadu_ps(centerY + i);
+					__m256 cz = _mm256_loadu_ps(centerZ + i);
+					__m256 ex = _mm256_loadu_ps(extentX + i);
+					__m256 ey = _mm256_loadu_ps(extentY + i);
+					__m256 ez = _mm256_loadu_ps(extentZ + i);
+
+					__m256 outside = _mm256_setzero_ps();
+					for (int p = 0; p < 6; p++)
+					{
+						__m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(cx, nx[p]), _mm256_mul_ps(cy, ny[p])), _mm256_mul_ps(cz, nz[p]));
+						__m256 r = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ex, ax[p]), _mm256_mul_ps(ey, ay[p])), _mm256_mul_ps(ez, az[p]));
+						outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(d, r), dNeg[p], _CMP_LT_OQ));
+					}
+
+					unsigned int visible = ~(unsigned int)_mm256_movemask_ps(outside) & 0xFF;
+					bits[i >> 5] |= visible << (i & 31);
+				}
+			}
+#endif
+#if defined(MATH_SIMD_SSE)
+			{
+				// Broadcast the planes once, instead of once per box
+				__m128 nx[6], ny[6], nz[6], ax[6], ay[6], az[6], dNeg[6];
+				for (int p = 0; p < 6; p++)
+				{
+					nx[p] = _mm_set1_ps(m_normalX[p]); ny[p] = _mm_set1_ps(m_normalY[p]); nz[p] = _mm_set1_ps(m_normalZ[p]);
+					ax[p] = _mm_set1_ps(m_absNormalX[p]); ay[p] = _mm_set1_ps(m_absNormalY[p]); az[p] = _mm_set1_ps(m_absNormalZ[p]);
+					dNeg[p] = _mm_set1_ps(-m_distance[p]);
+				}
+
+				// 4 boxes per iteration
+				for (; i + 4 <= count; i += 4)
+				{
+					__m128 cx = _mm_loadu_ps(centerX + i);
+					__m128 cy = _mm_loadu_ps(centerY + i);
+					__m128 cz = _mm_loadu_ps(centerZ + i);
+					__m128 ex = _mm_loadu_ps(extentX + i);
+					__m128 ey = _mm_loadu_ps(extentY + i);
+					__m128 ez = _mm_loadu_ps(extentZ + i);
+
+					__m128 outside = _mm_setzero_ps();
+					for (int p = 0; p < 6; p++)
+					{
+						__m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(cx, nx[p]), _mm_mul_ps(cy, ny[p])), _mm_mul_ps(cz, nz[p]));
+						__m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ex, ax[p]), _mm_mul_ps(ey, ay[p])), _mm_mul_ps(ez, az[p]));
+						outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(d, r), dNeg[p]));
+					}
+
+					unsigned int visible = ~(unsigned int)_mm_movemask_ps(outside) & 0xF;
+					bits[i >> 5] |= visible << (i & 31);
+				}
+			}
+#endif
+			// Whatever is left
+			for (; i < count; i++)
+			{
+				bool outside = false;
+				for (int p = 0; p < 6 && !outside; p++)
+				{
+					float d = centerX[i] * m_normalX[p] + centerY[i] * m_normalY[p] + centerZ[i] * m_normalZ[p];
+					float r = extentX[i] * m_absNormalX[p] + extentY[i] * m_absNormalY[p] + extentZ[i] * m_absNormalZ[p];
+					outside = d + r < -m_distance[p];
+				}
+
+				if (!outside)
+				{
+					bits[i >> 5] |= 1u << (i & 31);
+				}
+			}
+		}
+
+		void Frustrum::CheckSpheres(
+			const float* centerX, const float* centerY, const float* centerZ, const float* radius,
+			int count, std::vector<unsigned int>& visibility, std::vector<unsigned int>& intersecting
+		) const
+		{
+			visibility.assign((count + 31) / 32, 0);
+			intersecting.assign((count + 31) / 32, 0);
+			unsigned int* visibleBits = visibility.data();
+			unsigned int* intersectingBits = intersecting.data();
+
+			int i = 0;
+#if defined(MATH_SIMD_AVX)
+			{
+				// Broadcast the planes once, instead of once per sphere
+				__m256 nx[6], ny[6], nz[6], dist[6];
+				for (int p = 0; p < 6; p++)
+				{
+					nx[p] = _mm256_set1_ps(m_normalX[p]); ny[p] = _mm256_set1_ps(m_normalY[p]); nz[p] = _mm256_set1_ps(m_normalZ[p]);
+					dist[p] = _mm256_set1_ps(m_distance[p]);
+				}
+
+				// 8 spheres per iteration
+				for (; i + 8 <= count; i += 8)
+				{
+					__m256 cx = _mm256_loadu_ps(centerX + i);
+					__m256 cy = _mm256_loadu_ps(centerY + i);
+					__m256 cz = _mm256_loadu_ps(centerZ + i);
+					__m256 r = _mm256_loadu_ps(radius + i);
+					__m256 rNeg = _mm256_sub_ps(_mm256_setzero_ps(), r);
+
+					__m256 outside = _mm256_setzero_ps();
+					__m256 crossing = _mm256_setzero_ps();
+					for (int p = 0; p < 6; p++)
+					{
+						__m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(cx, nx[p]), _mm256_mul_ps(cy, ny[p])), _mm256_mul_ps(cz, nz[p])), dist[p]);
+						outside = _mm256_or_ps(outside, _mm256_cmp_ps(d, rNeg, _CMP_LT_OQ));
+						crossing = _mm256_or_ps(crossing, _mm256_cmp_ps(d, r, _CMP_LT_OQ));
+					}
+
+					unsigned int visible = ~(unsigned int)_mm256_movemask_ps(outside) & 0xFF;
+					visibleBits[i >> 5] |= visible << (i & 31);
+					intersectingBits[i >> 5] |= (visible & (unsigned int)_mm256_movemask_ps(crossing)) << (i & 31);
 				}
 			}
+#endif
+#if defined(MATH_SIMD_SSE)
+			{
+				// Broadcast the planes once, instead of once per sphere
+				__m128 nx[6], ny[6], nz[6], dist[6];
+				for (int p = 0; p < 6; p++)
+				{
+					nx[p] = _mm_set1_ps(m_normalX[p]); ny[p] = _mm_set1_ps(m_normalY[p]); nz[p] = _mm_set1_ps(m_normalZ[p]);
+					dist[p] = _mm_set1_ps(m_distance[p]);
+				}
 
-			// otherwise we are fully in view
-			return Inside;
+				// 4 spheres per iteration
+				for (; i + 4 <= count; i += 4)
+				{
+					__m128 cx = _mm_loadu_ps(centerX + i);
+					__m128 cy = _mm_loadu_ps(centerY + i);
+					__m128 cz = _mm_loadu_ps(centerZ + i);
+					__m128 r = _mm_loadu_ps(radius + i);
+					__m128 rNeg = _mm_sub_ps(_mm_setzero_ps(), r);
+
+					__m128 outside = _mm_setzero_ps();
+					__m128 crossing = _mm_setzero_ps();
+					for (int p = 0; p < 6; p++)
+					{
+						__m128 d = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(cx, nx[p]), _mm_mul_ps(cy, ny[p])), _mm_mul_ps(cz, nz[p])), dist[p]);
+						outside = _mm_or_ps(outside, _mm_cmplt_ps(d, rNeg));
+						crossing = _mm_or_ps(crossing, _mm_cmplt_ps(d, r));
+					}
+
+					unsigned int visible = ~(unsigned int)_mm_movemask_ps(outside) & 0xF;
+					visibleBits[i >> 5] |= visible << (i & 31);
+					intersectingBits[i >> 5] |= (visible & (unsigned int)_mm_movemask_ps(crossing)) << (i & 31);
+				}
+			}
+#endif
+			// Whatever is left
+			for (; i < count; i++)
+			{
+				bool outside = false;
+				bool crossing = false;
+				for (int p = 0; p < 6 && !outside; p++)
+				{
+					float d = centerX[i] * m_normalX[p] + centerY[i] * m_normalY[p] + centerZ[i] * m_normalZ[p] + m_distance[p];
+					outside = d < -radius[i];
+					crossing = crossing || d < radius[i];
+				}
+
+				if (!outside)
+				{
+					visibleBits[i >> 5] |= 1u << (i & 31);
+					if (crossing)
+					{
+						intersectingBits[i >> 5] |= 1u << (i & 31);
+					}
+				}
+			}
 		}
 	}
 }
\ No newline at end of file
@@ -25,6 +25,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Math/Vector3.h"
 #include "../Math/Plane.h"
 #include "../Math/Matrix.h"
+#include "../Math/OrientedBoundingBox.h"
+#include <vector>
 //==========================
 
 namespace Directus
@@ -40,9 +42,42 @@ namespace Directus
 			void Construct(const Matrix& mView, const Matrix&  mProjection, float screenDepth);
 			Intersection CheckCube(const Vector3& center, const Vector3& extent);
 			Intersection CheckSphere(const Vector3& center, float radius);
+			Intersection CheckOrientedBox(const OrientedBoundingBox& box);
+
+			// Same as above, but start from planeHint, which is set to the rejecting plane if there is one.
+			// Objects tend to be rejected by the same plane frame after frame, so that's usually a single test.
+			Intersection CheckCube(const Vector3& center, const Vector3& extent, int& planeHint);
+			Intersection CheckSphere(const Vector3& center, float radius, int& planeHint);
+			Intersection CheckOrientedBox(const OrientedBoundingBox& box, int& planeHint);
+
+			// Changes every time the frustum is constructed
+			unsigned int GetVersion() const { return m_version; }
+
+			// Tests many boxes at once, given as separate arrays of centers and extents (SoA).
+			// Bit i of visibility is set if box i is not outside of the frustum.
+			void CheckCubes(
+				const float* centerX, const float* centerY, const float* centerZ,
+				const float* extentX, const float* extentY, const float* extentZ,
+				int count, std::vector<unsigned int>& visibility
+			) const;
+
+			// Tests many spheres at once, given as separate arrays of centers and radii (SoA).
+			// Bit i of visibility is set if sphere i is not outside of the frustum and bit i of
+			// intersecting is set if it also crosses a plane, so only those need a tighter test.
+			void CheckSpheres(
+				const float* centerX, const float* centerY, const float* centerZ, const float* radius,
+				int count, std::vector<unsigned int>& visibility, std::vector<unsigned int>& intersecting
+			) const;
+
+			static bool IsVisible(const std::vector<unsigned int>& visibility, int index) { return (visibility[index >> 5] >> (index & 31)) & 1; }
 
 		private:
 			Plane m_planes[6];
+			unsigned int m_version;
+
+			// Plane data laid out for the batched tests, computed once per Construct()
+			float m_normalX[6], m_normalY[6], m_normalZ[6], m_distance[6];
+			float m_absNormalX[6], m_absNormalY[6], m_absNormalZ[6];
 		};
 	}
 }
\ No newline at end of file
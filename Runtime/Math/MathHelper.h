@@ -27,6 +27,19 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Core/Helper.h"
 //=========================
 
+// SSE2 is part of every x64 CPU, so it's used unless explicitly disabled
+// by defining MATH_DISABLE_SIMD, in which case the scalar code is used.
+#if !defined(MATH_DISABLE_SIMD) && (defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__))
+#define MATH_SIMD_SSE
+#include <emmintrin.h>
+#endif
+
+// AVX is only used when the compiler targets it (e.g. /arch:AVX2)
+#if defined(MATH_SIMD_SSE) && defined(__AVX__)
+#define MATH_SIMD_AVX
+#include <immintrin.h>
+#endif
+
 namespace Directus
 {
 	namespace Math
@@ -32,7 +32,8 @@ namespace Directus
 {
 	namespace Math
 	{
-		class DLL_API Matrix
+		// 16-byte aligned so that each column is a single SSE register
+		class alignas(16) DLL_API Matrix
 		{
 		public:
 			Matrix()
@@ -52,6 +53,17 @@ namespace Directus
 				this->m30 = m30; this->m31 = m31; this->m32 = m32; this->m33 = m33;
 			}
 
+#if defined(MATH_SIMD_SSE)
+			// Construct from four columns (memory order)
+			Matrix(__m128 c0, __m128 c1, __m128 c2, __m128 c3)
+			{
+				_mm_store_ps(&m00, c0);
+				_mm_store_ps(&m01, c1);
+				_mm_store_ps(&m02, c2);
+				_mm_store_ps(&m03, c3);
+			}
+#endif
+
 			Matrix(const Vector3& translation, const Quaternion& rotation, const Vector3& scale)
 			{
 				Matrix mRotation = CreateRotation(rotation);
@@ -244,12 +256,21 @@ namespace Directus
 			void Transpose() { *this = Transpose(*this); }
 			static Matrix Transpose(const Matrix& matrix)
 			{
+#if defined(MATH_SIMD_SSE)
+				__m128 c0 = _mm_load_ps(&matrix.m00);
+				__m128 c1 = _mm_load_ps(&matrix.m01);
+				__m128 c2 = _mm_load_ps(&matrix.m02);
+				__m128 c3 = _mm_load_ps(&matrix.m03);
+				_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+				return Matrix(c0, c1, c2, c3);
+#else
 				return Matrix(
 					matrix.m00, matrix.m10, matrix.m20, matrix.m30,
 					matrix.m01, matrix.m11, matrix.m21, matrix.m31,
 					matrix.m02, matrix.m12, matrix.m22, matrix.m32,
 					matrix.m03, matrix.m13, matrix.m23, matrix.m33
 				);
+#endif
 			}
 			//================================================================================================
 
@@ -257,6 +278,31 @@ namespace Directus
 			Matrix Inverted() const { return Invert(*this); }
 			static Matrix Invert(const Matrix& matrix)
 			{
+#if defined(MATH_SIMD_SSE)
+				// The columns in memory are the rows of the transpose, the inverse
+				// of the transpose is the transpose of the inverse, so it's enough
+				// to compute the cofactors of the rows and transpose them back.
+				__m128 r0 = _mm_load_ps(&matrix.m00);
+				__m128 r1 = _mm_load_ps(&matrix.m01);
+				__m128 r2 = _mm_load_ps(&matrix.m02);
+				__m128 r3 = _mm_load_ps(&matrix.m03);
+
+				// Cofactors as 4D cross products, which share their 2x2 minors in pairs
+				__m128 c0, c1, c2, c3;
+				CrossPair(r2, r3, r1, r0, c0, c1);
+				CrossPair(r0, r1, r3, r2, c2, c3);
+				c1 = _mm_sub_ps(_mm_setzero_ps(), c1);
+				c3 = _mm_sub_ps(_mm_setzero_ps(), c3);
+
+				// Determinant
+				__m128 det = _mm_mul_ps(r0, c0);
+				det = _mm_add_ps(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(2, 3, 0, 1)));
+				det = _mm_add_ps(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(1, 0, 3, 2)));
+				__m128 invDet = _mm_set1_ps(1.0f / _mm_cvtss_f32(det));
+
+				_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+				return Matrix(_mm_mul_ps(c0, invDet), _mm_mul_ps(c1, invDet), _mm_mul_ps(c2, invDet), _mm_mul_ps(c3, invDet));
+#else
 				float v0 = matrix.m20 * matrix.m31 - matrix.m21 * matrix.m30;
 				float v1 = matrix.m20 * matrix.m32 - matrix.m22 * matrix.m30;
 				float v2 = matrix.m20 * matrix.m33 - matrix.m23 *matrix.m30;
@@ -310,6 +356,7 @@ namespace Directus
 					i10, i11, i12, i13,
 					i20, i21, i22, i23,
 					i30, i31, i32, i33);
+#endif
 			}
 			//================================================================================================
 
@@ -331,6 +378,27 @@ namespace Directus
 			//= MULTIPLICATION ================================================================================================================
 			Matrix operator*(const Matrix& rhs) const
 			{
+#if defined(MATH_SIMD_SSE)
+				// Every column of the result is a linear combination of the columns of this matrix
+				__m128 c0 = _mm_load_ps(&m00);
+				__m128 c1 = _mm_load_ps(&m01);
+				__m128 c2 = _mm_load_ps(&m02);
+				__m128 c3 = _mm_load_ps(&m03);
+
+				__m128 result[4];
+				const float* rhsData = rhs.Data();
+				for (int i = 0; i < 4; i++)
+				{
+					__m128 column = _mm_load_ps(rhsData + i * 4);
+					__m128 sum = _mm_mul_ps(c0, _mm_shuffle_ps(column, column, _MM_SHUFFLE(0, 0, 0, 0)));
+					sum = _mm_add_ps(sum, _mm_mul_ps(c1, _mm_shuffle_ps(column, column, _MM_SHUFFLE(1, 1, 1, 1))));
+					sum = _mm_add_ps(sum, _mm_mul_ps(c2, _mm_shuffle_ps(column, column, _MM_SHUFFLE(2, 2, 2, 2))));
+					sum = _mm_add_ps(sum, _mm_mul_ps(c3, _mm_shuffle_ps(column, column, _MM_SHUFFLE(3, 3, 3, 3))));
+					result[i] = sum;
+				}
+
+				return Matrix(result[0], result[1], result[2], result[3]);
+#else
 				return Matrix(
 					m00 * rhs.m00 + m01 * rhs.m10 + m02 * rhs.m20 + m03 * rhs.m30,
 					m00 * rhs.m01 + m01 * rhs.m11 + m02 * rhs.m21 + m03 * rhs.m31,
@@ -349,9 +417,10 @@ namespace Directus
 					m30 * rhs.m02 + m31 * rhs.m12 + m32 * rhs.m22 + m33 * rhs.m32,
 					m30 * rhs.m03 + m31 * rhs.m13 + m32 * rhs.m23 + m33 * rhs.m33
 				);
+#endif
 			}
 
-			Vector3 Matrix::operator *(const Vector3& rhs) const
+			Vector3 operator *(const Vector3& rhs) const
 			{
 				Vector4 vWorking;
 
@@ -432,6 +501,38 @@ namespace Directus
 			// Note: HLSL expects column-major by default
 
 			static const Matrix Identity;
+
+		private:
+#if defined(MATH_SIMD_SSE)
+			// Computes the 4D cross products (generalized to three vectors) of a and d with
+			// the 2x2 minors of b and c, the minors are computed once and shared by both.
+			static void CrossPair(__m128 b, __m128 c, __m128 a, __m128 d, __m128& crossA, __m128& crossD)
+			{
+				__m128 b1000 = _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 0, 0, 1));
+				__m128 b2211 = _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 1, 2, 2));
+				__m128 b3332 = _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 3, 3));
+				__m128 c1000 = _mm_shuffle_ps(c, c, _MM_SHUFFLE(0, 0, 0, 1));
+				__m128 c2211 = _mm_shuffle_ps(c, c, _MM_SHUFFLE(1, 1, 2, 2));
+				__m128 c3332 = _mm_shuffle_ps(c, c, _MM_SHUFFLE(2, 3, 3, 3));
+
+				// p = (b2c3-b3c2, b2c3-b3c2, b1c3-b3c1, b1c2-b2c1), q and r follow the same pattern
+				__m128 p = _mm_sub_ps(_mm_mul_ps(b2211, c3332), _mm_mul_ps(b3332, c2211));
+				__m128 q = _mm_sub_ps(_mm_mul_ps(b1000, c3332), _mm_mul_ps(b3332, c1000));
+				__m128 r = _mm_sub_ps(_mm_mul_ps(b1000, c2211), _mm_mul_ps(b2211, c1000));
+
+				const __m128 sign = _mm_set_ps(-1.0f, 1.0f, -1.0f, 1.0f);
+				crossA = _mm_mul_ps(sign, Cross(a, p, q, r));
+				crossD = _mm_mul_ps(sign, Cross(d, p, q, r));
+			}
+
+			static __m128 Cross(__m128 a, __m128 p, __m128 q, __m128 r)
+			{
+				__m128 a1000 = _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 1));
+				__m128 a2211 = _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 2, 2));
+				__m128 a3332 = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 3, 3));
+				return _mm_add_ps(_mm_sub_ps(_mm_mul_ps(a1000, p), _mm_mul_ps(a2211, q)), _mm_mul_ps(a3332, r));
+			}
+#endif
 		};
 
 		// Reverse order operators
@@ -0,0 +1,86 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//= INCLUDES ====================
+#include "OrientedBoundingBox.h"
+#include "BoundingBox.h"
+#include "Matrix.h"
+//===============================
+
+namespace Directus
+{
+	namespace Math
+	{
+		OrientedBoundingBox::OrientedBoundingBox()
+		{
+			center = Vector3::Zero;
+			extents = Vector3(-1.0f, -1.0f, -1.0f);
+			axes[0] = Vector3::Right;
+			axes[1] = Vector3::Up;
+			axes[2] = Vector3::Forward;
+		}
+
+		OrientedBoundingBox::OrientedBoundingBox(const BoundingBox& box, const Matrix& transform)
+		{
+			if (!box.Defined())
+			{
+				*this = OrientedBoundingBox();
+				return;
+			}
+
+			center = transform * box.GetCenter();
+
+			// The rows of the matrix are the scaled local axes in world space
+			Vector3 halfSize = box.GetHalfSize();
+			Vector3 rows[3] =
+			{
+				Vector3(transform.m00, transform.m01, transform.m02),
+				Vector3(transform.m10, transform.m11, transform.m12),
+				Vector3(transform.m20, transform.m21, transform.m22)
+			};
+			float scales[3];
+			for (int i = 0; i < 3; i++)
+			{
+				scales[i] = rows[i].Length();
+				axes[i] = scales[i] != 0.0f ? rows[i] / scales[i] : Vector3::Zero;
+			}
+			extents = Vector3(halfSize.x * scales[0], halfSize.y * scales[1], halfSize.z * scales[2]);
+		}
+
+		OrientedBoundingBox::~OrientedBoundingBox()
+		{
+
+		}
+
+		Intersection OrientedBoundingBox::IsInside(const Vector3& point) const
+		{
+			Vector3 offset = point - center;
+			if (Abs(Vector3::Dot(offset, axes[0])) > extents.x ||
+				Abs(Vector3::Dot(offset, axes[1])) > extents.y ||
+				Abs(Vector3::Dot(offset, axes[2])) > extents.z)
+			{
+				return Outside;
+			}
+
+			return Inside;
+		}
+	}
+}
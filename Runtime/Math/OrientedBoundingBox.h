@@ -0,0 +1,61 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+//= INCLUDES ==========
+#include "MathHelper.h"
+#include "Vector3.h"
+//=====================
+
+namespace Directus
+{
+	namespace Math
+	{
+		class Matrix;
+		class BoundingBox;
+
+		class DLL_API OrientedBoundingBox
+		{
+		public:
+			// Construct undefined (negative extents).
+			OrientedBoundingBox();
+
+			// Construct from a local space bounding box and the (affine) matrix which places it in the world.
+			OrientedBoundingBox(const BoundingBox& box, const Matrix& transform);
+
+			~OrientedBoundingBox();
+
+			// Test if a point is inside
+			Intersection IsInside(const Vector3& point) const;
+
+			// Returns the volume, handy to tell how much tighter it is than an axis aligned box
+			float GetVolume() const { return 8.0f * extents.x * extents.y * extents.z; }
+
+			bool Defined() const { return extents.x >= 0.0f; }
+
+			Vector3 center;
+			Vector3 extents;
+			// Unit length world space axes
+			Vector3 axes[3];
+		};
+	}
+}
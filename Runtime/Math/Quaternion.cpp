@@ -69,6 +69,309 @@ namespace Directus
 			return Quaternion(0, 0, 0, 1);
 		}
 
+		//= BATCH OPERATIONS ======================================================================
+		static_assert(sizeof(Quaternion) == 4 * sizeof(float), "Quaternion is expected to be tightly packed");
+		static_assert(sizeof(Vector3) == 3 * sizeof(float), "Vector3 is expected to be tightly packed");
+
+		// Scalar versions, used for the remainder of the batches (or everything without SIMD)
+		static Quaternion NlerpScalar(const Quaternion& from, const Quaternion& to, float t)
+		{
+			float dot = from.x * to.x + from.y * to.y + from.z * to.z + from.w * to.w;
+			float sign = dot < 0.0f ? -1.0f : 1.0f; // take the shortest path
+			Quaternion q = Quaternion(
+				from.x + (to.x * sign - from.x) * t,
+				from.y + (to.y * sign - from.y) * t,
+				from.z + (to.z * sign - from.z) * t,
+				from.w + (to.w * sign - from.w) * t
+			);
+			q.Normalize();
+
+			return q;
+		}
+
+		static void SlerpWeights(float dot, float t, float& weightFrom, float& weightTo)
+		{
+			float sign = dot < 0.0f ? -1.0f : 1.0f; // take the shortest path
+			dot *= sign;
+
+			// Very close, fall back to linear interpolation to avoid dividing by ~0
+			if (dot > 0.9995f)
+			{
+				weightFrom = 1.0f - t;
+				weightTo = t * sign;
+				return;
+			}
+
+			float theta = acosf(dot);
+			float invSinTheta = 1.0f / sinf(theta);
+			weightFrom = sinf((1.0f - t) * theta) * invSinTheta;
+			weightTo = sinf(t * theta) * invSinTheta * sign;
+		}
+
+		static Quaternion SlerpScalar(const Quaternion& from, const Quaternion& to, float t)
+		{
+			float weightFrom, weightTo;
+			SlerpWeights(from.x * to.x + from.y * to.y + from.z * to.z + from.w * to.w, t, weightFrom, weightTo);
+			Quaternion q = Quaternion(
+				from.x * weightFrom + to.x * weightTo,
+				from.y * weightFrom + to.y * weightTo,
+				from.z * weightFrom + to.z * weightTo,
+				from.w * weightFrom + to.w * weightTo
+			);
+			q.Normalize();
+
+			return q;
+		}
+
+#if defined(MATH_SIMD_SSE)
+		// Loads four quaternions as x, y, z, w registers
+		static void LoadQuaternions(const Quaternion* q, __m128& x, __m128& y, __m128& z, __m128& w)
+		{
+			x = _mm_loadu_ps(&q[0].x);
+			y = _mm_loadu_ps(&q[1].x);
+			z = _mm_loadu_ps(&q[2].x);
+			w = _mm_loadu_ps(&q[3].x);
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+		}
+
+		static void StoreQuaternions(Quaternion* q, __m128 x, __m128 y, __m128 z, __m128 w)
+		{
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+			_mm_storeu_ps(&q[0].x, x);
+			_mm_storeu_ps(&q[1].x, y);
+			_mm_storeu_ps(&q[2].x, z);
+			_mm_storeu_ps(&q[3].x, w);
+		}
+
+		// Loads four vectors (12 floats) as x, y, z registers
+		static void LoadVectors(const Vector3* v, __m128& x, __m128& y, __m128& z)
+		{
+			const float* data = &v[0].x;
+			__m128 v0 = _mm_loadu_ps(data);		// x0 y0 z0 x1
+			__m128 v1 = _mm_loadu_ps(data + 4);	// y1 z1 x2 y2
+			__m128 v2 = _mm_loadu_ps(data + 8);	// z2 x3 y3 z3
+
+			__m128 t0 = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(1, 1, 2, 2)); // x2 x2 x3 x3
+			x = _mm_shuffle_ps(v0, t0, _MM_SHUFFLE(2, 0, 3, 0));
+
+			__m128 t1 = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(0, 0, 1, 1)); // y0 y0 y1 y1
+			__m128 t2 = _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(2, 2, 3, 3)); // y2 y2 y3 y3
+			y = _mm_shuffle_ps(t1, t2, _MM_SHUFFLE(2, 0, 2, 0));
+
+			__m128 t3 = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(1, 1, 2, 2)); // z0 z0 z1 z1
+			z = _mm_shuffle_ps(t3, v2, _MM_SHUFFLE(3, 0, 2, 0));
+		}
+
+		static void StoreVectors(Vector3* v, __m128 x, __m128 y, __m128 z)
+		{
+			__m128 v0 = _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+			__m128 v1 = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+			__m128 v2 = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+
+			float* data = &v[0].x;
+			_mm_storeu_ps(data, v0);
+			_mm_storeu_ps(data + 4, v1);
+			_mm_storeu_ps(data + 8, v2);
+		}
+
+		// Normalizes four quaternions, quaternions with a length of zero are left as they are
+		static void Normalize4(__m128& x, __m128& y, __m128& z, __m128& w)
+		{
+			__m128 lenSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_add_ps(_mm_mul_ps(z, z), _mm_mul_ps(w, w)));
+			__m128 valid = _mm_cmpgt_ps(lenSquared, _mm_setzero_ps());
+			__m128 invLen = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(lenSquared));
+			invLen = _mm_or_ps(_mm_and_ps(valid, invLen), _mm_andnot_ps(valid, _mm_set1_ps(1.0f)));
+
+			x = _mm_mul_ps(x, invLen);
+			y = _mm_mul_ps(y, invLen);
+			z = _mm_mul_ps(z, invLen);
+			w = _mm_mul_ps(w, invLen);
+		}
+
+		// The slerp weights sin((1 - t) * theta) / sin(theta) and sin(t * theta) / sin(theta) as polynomials in
+		// cos(theta) - 1, from Eberly's "A Fast and Accurate Algorithm for Computing SLERP". They only take
+		// multiplies and adds, so there is no trigonometry per lane. With the last of the 14 terms scaled,
+		// the error stays below 2e-7 for t in [0, 1] and cos(theta) in [0, 1].
+		static const int SLERP_TERMS = 14;
+		static const float SLERP_MU = 1.907f;
+
+		static void SlerpWeights4(__m128 cosTheta, __m128 t, __m128& weightFrom, __m128& weightTo)
+		{
+			__m128 one = _mm_set1_ps(1.0f);
+			__m128 cosThetaMinusOne = _mm_sub_ps(cosTheta, one);
+			__m128 d = _mm_sub_ps(one, t);
+			__m128 tSquared = _mm_mul_ps(t, t);
+			__m128 dSquared = _mm_mul_ps(d, d);
+
+			// f = 1 + b1 * (1 + b2 * (... * (1 + b14))), evaluated from the innermost term
+			__m128 fromSum = one;
+			__m128 toSum = one;
+			for (int i = SLERP_TERMS - 1; i >= 0; i--)
+			{
+				// u = 1 / (n * (2n + 1)) and v = n / (2n + 1), for the n-th term
+				float n = (float)(i + 1);
+				float scale = i == SLERP_TERMS - 1 ? SLERP_MU : 1.0f;
+				__m128 u = _mm_set1_ps(scale / (n * (2.0f * n + 1.0f)));
+				__m128 v = _mm_set1_ps(scale * n / (2.0f * n + 1.0f));
+				__m128 bFrom = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(u, dSquared), v), cosThetaMinusOne);
+				__m128 bTo = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(u, tSquared), v), cosThetaMinusOne);
+				fromSum = _mm_add_ps(one, _mm_mul_ps(bFrom, fromSum));
+				toSum = _mm_add_ps(one, _mm_mul_ps(bTo, toSum));
+			}
+
+			weightFrom = _mm_mul_ps(d, fromSum);
+			weightTo = _mm_mul_ps(t, toSum);
+		}
+
+		static __m128 Dot4(__m128 ax, __m128 ay, __m128 az, __m128 aw, __m128 bx, __m128 by, __m128 bz, __m128 bw)
+		{
+			return _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_add_ps(_mm_mul_ps(az, bz), _mm_mul_ps(aw, bw)));
+		}
+#endif
+
+		void Quaternion::MultiplyBatch(const Quaternion* lhs, const Quaternion* rhs, Quaternion* result, int count)
+		{
+			int i = 0;
+#if defined(MATH_SIMD_SSE)
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 ax, ay, az, aw, bx, by, bz, bw;
+				LoadQuaternions(&lhs[i], ax, ay, az, aw);
+				LoadQuaternions(&rhs[i], bx, by, bz, bw);
+
+				__m128 x = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(aw, bx), _mm_mul_ps(ax, bw)), _mm_mul_ps(ay, bz)), _mm_mul_ps(az, by));
+				__m128 y = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(aw, by), _mm_mul_ps(ay, bw)), _mm_mul_ps(az, bx)), _mm_mul_ps(ax, bz));
+				__m128 z = _mm_sub_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(aw, bz), _mm_mul_ps(az, bw)), _mm_mul_ps(ax, by)), _mm_mul_ps(ay, bx));
+				__m128 w = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_mul_ps(aw, bw), _mm_mul_ps(ax, bx)), _mm_mul_ps(ay, by)), _mm_mul_ps(az, bz));
+
+				StoreQuaternions(&result[i], x, y, z, w);
+			}
+#endif
+			for (; i < count; i++)
+			{
+				result[i] = lhs[i] * rhs[i];
+			}
+		}
+
+		void Quaternion::RotateBatch(const Quaternion* rotations, const Vector3* vectors, Vector3* result, int count)
+		{
+			int i = 0;
+#if defined(MATH_SIMD_SSE)
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 qx, qy, qz, qw, vx, vy, vz;
+				LoadQuaternions(&rotations[i], qx, qy, qz, qw);
+				LoadVectors(&vectors[i], vx, vy, vz);
+
+				// cross1 = q.xyz x v
+				__m128 c1x = _mm_sub_ps(_mm_mul_ps(qy, vz), _mm_mul_ps(qz, vy));
+				__m128 c1y = _mm_sub_ps(_mm_mul_ps(qz, vx), _mm_mul_ps(qx, vz));
+				__m128 c1z = _mm_sub_ps(_mm_mul_ps(qx, vy), _mm_mul_ps(qy, vx));
+
+				// cross2 = q.xyz x cross1
+				__m128 c2x = _mm_sub_ps(_mm_mul_ps(qy, c1z), _mm_mul_ps(qz, c1y));
+				__m128 c2y = _mm_sub_ps(_mm_mul_ps(qz, c1x), _mm_mul_ps(qx, c1z));
+				__m128 c2z = _mm_sub_ps(_mm_mul_ps(qx, c1y), _mm_mul_ps(qy, c1x));
+
+				// v + 2 * (cross1 * w + cross2)
+				__m128 two = _mm_set1_ps(2.0f);
+				vx = _mm_add_ps(vx, _mm_mul_ps(two, _mm_add_ps(_mm_mul_ps(c1x, qw), c2x)));
+				vy = _mm_add_ps(vy, _mm_mul_ps(two, _mm_add_ps(_mm_mul_ps(c1y, qw), c2y)));
+				vz = _mm_add_ps(vz, _mm_mul_ps(two, _mm_add_ps(_mm_mul_ps(c1z, qw), c2z)));
+
+				StoreVectors(&result[i], vx, vy, vz);
+			}
+#endif
+			for (; i < count; i++)
+			{
+				result[i] = rotations[i] * vectors[i];
+			}
+		}
+
+		void Quaternion::NormalizeBatch(Quaternion* quaternions, int count)
+		{
+			int i = 0;
+#if defined(MATH_SIMD_SSE)
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 x, y, z, w;
+				LoadQuaternions(&quaternions[i], x, y, z, w);
+				Normalize4(x, y, z, w);
+				StoreQuaternions(&quaternions[i], x, y, z, w);
+			}
+#endif
+			for (; i < count; i++)
+			{
+				quaternions[i].Normalize();
+			}
+		}
+
+		void Quaternion::NlerpBatch(const Quaternion* from, const Quaternion* to, const float* t, Quaternion* result, int count)
+		{
+			int i = 0;
+#if defined(MATH_SIMD_SSE)
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 ax, ay, az, aw, bx, by, bz, bw;
+				LoadQuaternions(&from[i], ax, ay, az, aw);
+				LoadQuaternions(&to[i], bx, by, bz, bw);
+				__m128 factor = _mm_loadu_ps(&t[i]);
+
+				// Take the shortest path by flipping the sign of "to" where the dot product is negative
+				__m128 signMask = _mm_and_ps(Dot4(ax, ay, az, aw, bx, by, bz, bw), _mm_set1_ps(-0.0f));
+				bx = _mm_xor_ps(bx, signMask);
+				by = _mm_xor_ps(by, signMask);
+				bz = _mm_xor_ps(bz, signMask);
+				bw = _mm_xor_ps(bw, signMask);
+
+				__m128 x = _mm_add_ps(ax, _mm_mul_ps(_mm_sub_ps(bx, ax), factor));
+				__m128 y = _mm_add_ps(ay, _mm_mul_ps(_mm_sub_ps(by, ay), factor));
+				__m128 z = _mm_add_ps(az, _mm_mul_ps(_mm_sub_ps(bz, az), factor));
+				__m128 w = _mm_add_ps(aw, _mm_mul_ps(_mm_sub_ps(bw, aw), factor));
+				Normalize4(x, y, z, w);
+
+				StoreQuaternions(&result[i], x, y, z, w);
+			}
+#endif
+			for (; i < count; i++)
+			{
+				result[i] = NlerpScalar(from[i], to[i], t[i]);
+			}
+		}
+
+		void Quaternion::SlerpBatch(const Quaternion* from, const Quaternion* to, const float* t, Quaternion* result, int count)
+		{
+			int i = 0;
+#if defined(MATH_SIMD_SSE)
+			for (; i + 4 <= count; i += 4)
+			{
+				__m128 ax, ay, az, aw, bx, by, bz, bw;
+				LoadQuaternions(&from[i], ax, ay, az, aw);
+				LoadQuaternions(&to[i], bx, by, bz, bw);
+
+				// Take the shortest path, as the weights are only valid for a positive dot product
+				__m128 dot = Dot4(ax, ay, az, aw, bx, by, bz, bw);
+				__m128 signMask = _mm_and_ps(dot, _mm_set1_ps(-0.0f));
+				__m128 wa, wb;
+				SlerpWeights4(_mm_xor_ps(dot, signMask), _mm_loadu_ps(&t[i]), wa, wb);
+				wb = _mm_xor_ps(wb, signMask);
+
+				__m128 x = _mm_add_ps(_mm_mul_ps(ax, wa), _mm_mul_ps(bx, wb));
+				__m128 y = _mm_add_ps(_mm_mul_ps(ay, wa), _mm_mul_ps(by, wb));
+				__m128 z = _mm_add_ps(_mm_mul_ps(az, wa), _mm_mul_ps(bz, wb));
+				__m128 w = _mm_add_ps(_mm_mul_ps(aw, wa), _mm_mul_ps(bw, wb));
+				Normalize4(x, y, z, w);
+
+				StoreQuaternions(&result[i], x, y, z, w);
+			}
+#endif
+			for (; i < count; i++)
+			{
+				result[i] = SlerpScalar(from[i], to[i], t[i]);
+			}
+		}
+		//========================================================================================
+
 		string Quaternion::ToString() const
 		{
 			char tempBuffer[200];
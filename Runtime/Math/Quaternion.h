@@ -34,7 +34,7 @@ namespace Directus
 		{
 		public:
 			// Constructs an identity quaternion
-			Quaternion::Quaternion()
+			Quaternion()
 			{
 				x = 0;
 				y = 0;
@@ -43,7 +43,7 @@ namespace Directus
 			}
 
 			// Constructs a new quaternion with the given components
-			Quaternion::Quaternion(float x, float y, float z, float w)
+			Quaternion(float x, float y, float z, float w)
 			{
 				this->x = x;
 				this->y = y;
@@ -70,7 +70,7 @@ namespace Directus
 				return q;
 			}
 
-			void Quaternion::FromAxes(const Vector3& xAxis, const Vector3& yAxis, const Vector3& zAxis);
+			void FromAxes(const Vector3& xAxis, const Vector3& yAxis, const Vector3& zAxis);
 			static Quaternion FromEulerAngles(const Vector3& eulerAngles) { return FromEulerAngles(eulerAngles.x, eulerAngles.y, eulerAngles.z); }
 
 			static Quaternion FromEulerAngles(float x, float y, float z)
@@ -182,7 +182,7 @@ namespace Directus
 				return true;
 			}
 
-			Quaternion Conjugate() const { return Quaternion(w, -x, -y, -z); }
+			Quaternion Conjugate() const { return Quaternion(-x, -y, -z, w); }
 			float LengthSquared() const { return w * w + x * x + y * y + z * z; }
 
 			//= NORMALIZATION ============================================================================
@@ -230,10 +230,10 @@ namespace Directus
 			Quaternion operator*(const Quaternion& rhs) const
 			{
 				return Quaternion(
-					w * rhs.w - x * rhs.x - y * rhs.y - z * rhs.z,
 					w * rhs.x + x * rhs.w + y * rhs.z - z * rhs.y,
-					w * rhs.y + y * rhs.w + z * rhs.x - x* rhs.z,
-					w * rhs.z + z * rhs.w + x * rhs.y - y * rhs.x
+					w * rhs.y + y * rhs.w + z * rhs.x - x * rhs.z,
+					w * rhs.z + z * rhs.w + x * rhs.y - y * rhs.x,
+					w * rhs.w - x * rhs.x - y * rhs.y - z * rhs.z
 				);
 			}
 
@@ -264,7 +264,17 @@ namespace Directus
 				return *this;
 			}
 
-			Quaternion operator *(float rhs) const { return Quaternion(w * rhs, x * rhs, y * rhs, z * rhs); }
+			Quaternion operator *(float rhs) const { return Quaternion(x * rhs, y * rhs, z * rhs, w * rhs); }
+			//===============================================================================================================
+
+			//= BATCH OPERATIONS ============================================================================================
+			// Operate on arrays of quaternions/vectors, four at a time when SIMD is available.
+			// The result arrays can alias the input arrays.
+			static void MultiplyBatch(const Quaternion* lhs, const Quaternion* rhs, Quaternion* result, int count);
+			static void RotateBatch(const Quaternion* rotations, const Vector3* vectors, Vector3* result, int count);
+			static void NormalizeBatch(Quaternion* quaternions, int count);
+			static void NlerpBatch(const Quaternion* from, const Quaternion* to, const float* t, Quaternion* result, int count);
+			static void SlerpBatch(const Quaternion* from, const Quaternion* to, const float* t, Quaternion* result, int count);
 			//===============================================================================================================
 
 			//= COMPARISON ==================================================================================================
@@ -22,7 +22,9 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 //= INCLUDES ===========
 #include "Ray.h"
 #include "BoundingBox.h"
-//======================
+#include "BoundingSphere.h"
+#include "OrientedBoundingBox.h"
+//============================
 
 namespace Directus
 {
@@ -47,7 +49,7 @@ namespace Directus
 
 		}
 
-		float Ray::HitDistance(const BoundingBox& box)
+		float Ray::HitDistance(const BoundingBox& box) const
 		{
 			// If undefined, no hit (infinite distance)
 			if (!box.Defined())
@@ -137,5 +139,64 @@ namespace Directus
 
 			return dist;
 		}
+
+		float Ray::HitDistance(const BoundingSphere& sphere) const
+		{
+			// If undefined, no hit (infinite distance)
+			if (!sphere.Defined())
+				return INFINITY;
+
+			Vector3 offset = m_origin - sphere.center;
+			float c = offset.LengthSquared() - sphere.radius * sphere.radius;
+
+			// Check for ray origin being inside the sphere
+			if (c <= 0.0f)
+				return 0.0f;
+
+			// Pointing away from the sphere or missing it
+			float b = Vector3::Dot(offset, m_direction);
+			float discriminant = b * b - c;
+			if (b > 0.0f || discriminant < 0.0f)
+				return INFINITY;
+
+			return -b - Sqrt(discriminant);
+		}
+
+		float Ray::HitDistance(const OrientedBoundingBox& box) const
+		{
+			// If undefined, no hit (infinite distance)
+			if (!box.Defined())
+				return INFINITY;
+
+			// Slab test against the three pairs of planes of the box
+			float distMin = 0.0f;
+			float distMax = INFINITY;
+			Vector3 offset = box.center - m_origin;
+			float extents[3] = { box.extents.x, box.extents.y, box.extents.z };
+			for (int i = 0; i < 3; i++)
+			{
+				float e = Vector3::Dot(box.axes[i], offset);
+				float f = Vector3::Dot(box.axes[i], m_direction);
+
+				if (Abs(f) > 0.000001f)
+				{
+					float t1 = (e + extents[i]) / f;
+					float t2 = (e - extents[i]) / f;
+					if (t1 > t2) { float t = t1; t1 = t2; t2 = t; }
+
+					distMin = Max(distMin, t1);
+					distMax = Min(distMax, t2);
+					if (distMin > distMax)
+						return INFINITY;
+				}
+				// Parallel to the slab, so the origin has to lie within it
+				else if (-e - extents[i] > 0.0f || -e + extents[i] < 0.0f)
+				{
+					return INFINITY;
+				}
+			}
+
+			return distMin;
+		}
 	}
 }
\ No newline at end of file
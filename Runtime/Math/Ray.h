@@ -31,6 +31,8 @@ namespace Directus
 	namespace Math
 	{
 		class BoundingBox;
+		class BoundingSphere;
+		class OrientedBoundingBox;
 
 		class DLL_API Ray
 		{
@@ -45,11 +47,17 @@ namespace Directus
 			~Ray();
 
 			// Returns hit distance to a bounding box, or infinity if there is hit.
-			float HitDistance(const BoundingBox& box);
+			float HitDistance(const BoundingBox& box) const;
 
-			Vector3 GetOrigin() { return m_origin; }
-			Vector3 GetEnd() { return m_end; }
-			Vector3 GetDirection() { return m_direction; }
+			// Returns hit distance to a bounding sphere, or infinity if there is no hit.
+			float HitDistance(const BoundingSphere& sphere) const;
+
+			// Returns hit distance to an oriented bounding box, or infinity if there is no hit.
+			float HitDistance(const OrientedBoundingBox& box) const;
+
+			Vector3 GetOrigin() const { return m_origin; }
+			Vector3 GetEnd() const { return m_end; }
+			Vector3 GetDirection() const { return m_direction; }
 
 		private:
 			Vector3 m_origin;
@@ -33,21 +33,21 @@ namespace Directus
 		class DLL_API Vector2
 		{
 		public:
-			Vector2::Vector2()
+			Vector2()
 			{
 				x = 0;
 				y = 0;
 			}
 
-			Vector2::Vector2(float x, float y)
+			Vector2(float x, float y)
 			{
 				this->x = x;
 				this->y = y;
 			}
 
-			Vector2::~Vector2() {}
+			~Vector2() {}
 
-			Vector2 Vector2::operator+(const Vector2& b)
+			Vector2 operator+(const Vector2& b)
 			{
 				return Vector2
 				(
@@ -56,7 +56,7 @@ namespace Directus
 				);
 			}
 
-			void Vector2::operator+=(const Vector2& b)
+			void operator+=(const Vector2& b)
 			{
 				this->x += b.x;
 				this->y += b.y;
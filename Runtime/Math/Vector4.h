@@ -36,7 +36,7 @@ namespace Directus
 		class DLL_API Vector4
 		{
 		public:
-			Vector4::Vector4()
+			Vector4()
 			{
 				x = 0;
 				y = 0;
@@ -44,7 +44,7 @@ namespace Directus
 				w = 0;
 			}
 
-			Vector4::Vector4(float x, float y, float z, float w)
+			Vector4(float x, float y, float z, float w)
 			{
 				this->x = x;
 				this->y = y;
@@ -52,7 +52,7 @@ namespace Directus
 				this->w = w;
 			}
 
-			Vector4::Vector4(float value)
+			Vector4(float value)
 			{
 				this->x = value;
 				this->y = value;
@@ -60,12 +60,12 @@ namespace Directus
 				this->w = value;
 			}
 
-			Vector4::Vector4(const Vector3& value, float w);
-			Vector4::Vector4(const Vector3& value);
+			Vector4(const Vector3& value, float w);
+			Vector4(const Vector3& value);
 
-			Vector4::~Vector4(){}
+			~Vector4(){}
 
-			bool Vector4::operator==(const Vector4& b)
+			bool operator==(const Vector4& b)
 			{
 				if (this->x == b.x && this->y == b.y && this->z == b.z && this->w == b.w)
 					return true;
@@ -73,7 +73,7 @@ namespace Directus
 				return false;
 			}
 
-			bool Vector4::operator!=(const Vector4& b)
+			bool operator!=(const Vector4& b)
 			{
 				if (this->x != b.x || this->y != b.y || this->z != b.z || this->w != b.w)
 					return true;
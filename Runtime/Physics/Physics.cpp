@@ -37,9 +37,10 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Core/Engine.h"
 //==============================================================================
 
-//= NAMESPACES =====
+//= NAMESPACES ================
 using namespace std;
-//==================
+using namespace Directus::Math;
+//=============================
 
 namespace Directus
 { 
@@ -106,6 +107,25 @@ namespace Directus
 		m_world->stepSimulation(timeStep, m_maxSubSteps, fixedTimeStep);
 
 		m_simulating = false;
+
+		// Move the positions from the collider centers to the transforms, then apply them
+		int writeCount = (int)m_transformWrites.size();
+		Quaternion::RotateBatch(m_writeRotations.data(), m_writeCenters.data(), m_writeCenters.data(), writeCount);
+		for (int i = 0; i < writeCount; i++)
+		{
+			m_transformWrites[i].position = m_transformWrites[i].position - m_writeCenters[i];
+		}
+		Transform::SetWorldBatch(m_transformWrites);
+		m_transformWrites.clear();
+		m_writeRotations.clear();
+		m_writeCenters.clear();
+	}
+
+	void Physics::QueueTransformWrite(const TransformWrite& write, const Vector3& colliderCenter)
+	{
+		m_transformWrites.push_back(write);
+		m_writeRotations.push_back(write.rotation);
+		m_writeCenters.push_back(colliderCenter);
 	}
 
 	void Physics::Clear()
@@ -22,9 +22,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 //= INCLUDES =================
+#include <vector>
 #include "../Math/Vector3.h"
 #include "../Core/Subsystem.h"
-//============================
+#include "../Components/Transform.h"
+//==================================
 
 class btVector3;
 class btBroadphaseInterface;
@@ -57,6 +59,11 @@ namespace Directus
 		PhysicsDebugDraw* GetPhysicsDebugDraw();
 		bool IsSimulating() { return m_simulating; }
 
+		// Transform writes coming from the simulation are queued and applied in a single batch
+		// after the step. The write's position is the collider's, the rotated collider center
+		// is subtracted from all the queued positions at once.
+		void QueueTransformWrite(const TransformWrite& write, const Math::Vector3& colliderCenter);
+
 	private:
 		btBroadphaseInterface* m_broadphase;
 		btCollisionDispatcher* m_dispatcher;
@@ -71,5 +78,9 @@ namespace Directus
 		Math::Vector3 m_gravity;
 		bool m_simulating;
 		//=================================
+
+		std::vector<TransformWrite> m_transformWrites;
+		std::vector<Math::Quaternion> m_writeRotations;
+		std::vector<Math::Vector3> m_writeCenters;
 	};
 }
\ No newline at end of file
@@ -25,11 +25,16 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Core/Timer.h"
 #include "../Core/Scene.h"
 #include "../Graphics/Material.h"
+#include "../Graphics/Renderer.h"
 #include "../Graphics/DeferredShaders/ShaderVariation.h"
 #include "../Resource/ResourceManager.h"
 #include "../EventSystem/EventSystem.h"
 #include <iomanip>
 #include <sstream>
+#include <fstream>
+#include <map>
+#include <set>
+#include <algorithm>
 //=====================================================
 
 //= NAMESPACES =====
@@ -41,10 +46,13 @@ namespace Directus
 	Scene* PerformanceProfiler::m_scene;
 	Timer* PerformanceProfiler::m_timer;
 	ResourceManager* PerformanceProfiler::m_resourceManager;
+	Renderer* PerformanceProfiler::m_renderer;
 	unique_ptr<Stopwatch> PerformanceProfiler::m_renderTimer;
 	float PerformanceProfiler::m_renderTimeMs;
 	int PerformanceProfiler::m_renderedMeshesCount;
 	int PerformanceProfiler::m_renderedMeshesPerFrame;
+	size_t PerformanceProfiler::m_memoryUsageCPU;
+	size_t PerformanceProfiler::m_memoryUsageGPU;
 	string PerformanceProfiler::m_metrics;
 	float PerformanceProfiler::m_updateFrequencyMs;
 	float PerformanceProfiler::m_timeSinceLastUpdate;
@@ -55,11 +63,15 @@ namespace Directus
 		m_scene = context->GetSubsystem<Scene>();
 		m_timer = context->GetSubsystem<Timer>();
 		m_resourceManager = context->GetSubsystem<ResourceManager>();
+		m_renderer = context->GetSubsystem<Renderer>();
 
 		// Metrics
 		m_renderTimeMs = 0;
 		m_renderedMeshesCount = 0;
 		m_renderedMeshesPerFrame = 0;
+		m_memoryUsageCPU = 0;
+		m_memoryUsageGPU = 0;
+
 		// Settings
 		m_updateFrequencyMs = 200;
 
@@ -101,6 +113,14 @@ namespace Directus
 		int materials = m_resourceManager->GetResourceCountByType<Material>();
 		int shaders = m_resourceManager->GetResourceCountByType<ShaderVariation>();
 
+		m_memoryUsageCPU = 0;
+		m_memoryUsageGPU = m_renderer->GetMemoryUsageGPU();
+		for (const auto& resource : m_resourceManager->GetAllResources())
+		{
+			m_memoryUsageCPU += resource->GetMemoryUsageCPU();
+			m_memoryUsageGPU += resource->GetMemoryUsageGPU();
+		}
+
 		m_metrics =
 			"FPS: " + To_String_Precision(fps, 2) + "\n"
 			"Frame: " + To_String_Precision(delta, 2) + " ms\n"
@@ -108,11 +128,169 @@ namespace Directus
 			"Render: " + To_String_Precision(m_renderTimeMs, 2) + " ms\n"
 			"Meshes Rendered: " + to_string(m_renderedMeshesPerFrame) + "\n"
 			"Materials: " + to_string(materials) + "\n"
-			"Shaders: " + to_string(shaders);
+			"Shaders: " + to_string(shaders) + "\n"
+			"Memory CPU: " + To_String_Precision(m_memoryUsageCPU / 1048576.0f, 2) + " MB\n"
+			"Memory GPU: " + To_String_Precision(m_memoryUsageGPU / 1048576.0f, 2) + " MB";
 
 		m_timeSinceLastUpdate = 0;
 	}
 
+	//= MEMORY ====================================================================================================
+	struct MemoryUsage
+	{
+		std::string name;
+		std::string path;
+		size_t cpu = 0;
+		size_t gpu = 0;
+		int count = 0;
+	};
+
+	static const char* resourceTypeNames[] =
+	{
+		"Unknown",
+		"Texture",
+		"Audio",
+		"Material",
+		"Shader",
+		"Model",
+		"Cubemap",
+		"Script",
+		"Animation",
+		"Font"
+	};
+
+	static void WriteMemoryUsage(ofstream& report, vector<MemoryUsage> usages)
+	{
+		sort(usages.begin(), usages.end(), [](const MemoryUsage& a, const MemoryUsage& b) { return a.cpu + a.gpu > b.cpu + b.gpu; });
+
+		report << left << setw(40) << "Name" << right << setw(8) << "Count" << setw(14) << "CPU (KB)" << setw(14) << "GPU (KB)" << "  Path\n";
+		for (const auto& usage : usages)
+		{
+			report << left << setw(40) << usage.name << right << setw(8) << usage.count;
+			report << setw(14) << usage.cpu / 1024 << setw(14) << usage.gpu / 1024 << "  " << usage.path << "\n";
+		}
+		report << "\n";
+	}
+
+	bool PerformanceProfiler::DumpMemoryReport(const string& filePath)
+	{
+		ofstream report(filePath, ios::out);
+		if (report.fail())
+		{
+			LOG_ERROR("PerformanceProfiler: Failed to write memory report \"" + filePath + "\".");
+			return false;
+		}
+
+		auto resources = m_resourceManager->GetAllResources();
+
+		// Per resource and per type
+		vector<MemoryUsage> perResource;
+		map<ResourceType, MemoryUsage> perType;
+		map<string, shared_ptr<Resource>> textures;
+		for (const auto& resource : resources)
+		{
+			MemoryUsage usage;
+			usage.name = string(resourceTypeNames[resource->GetResourceType()]) + " " + resource->GetResourceName();
+			usage.path = resource->GetResourceFilePath();
+			usage.cpu = resource->GetMemoryUsageCPU();
+			usage.gpu = resource->GetMemoryUsageGPU();
+			usage.count = 1;
+			perResource.push_back(usage);
+
+			MemoryUsage& typeUsage = perType[resource->GetResourceType()];
+			typeUsage.name = resourceTypeNames[resource->GetResourceType()];
+			typeUsage.cpu += usage.cpu;
+			typeUsage.gpu += usage.gpu;
+			typeUsage.count++;
+
+			if (resource->GetResourceType() == Texture_Resource)
+			{
+				textures[FileSystem::NormalizePath(resource->GetResourceFilePath())] = resource;
+			}
+		}
+
+		MemoryUsage renderTargets;
+		renderTargets.name = "Render targets";
+		renderTargets.gpu = m_renderer->GetMemoryUsageGPU();
+		renderTargets.count = 1;
+
+		// Per model, its meshes along with the materials it imported and their textures
+		map<unsigned int, MemoryUsage> perModel;
+		map<unsigned int, set<Resource*>> modelTextures;
+		for (const auto& resource : resources)
+		{
+			if (resource->GetResourceType() != Model_Resource)
+				continue;
+
+			MemoryUsage& usage = perModel[resource->GetResourceID()];
+			usage.name = resource->GetResourceName();
+			usage.path = resource->GetResourceFilePath();
+			usage.cpu = resource->GetMemoryUsageCPU();
+			usage.gpu = resource->GetMemoryUsageGPU();
+			usage.count = 1;
+		}
+
+		for (const auto& resource : resources)
+		{
+			if (resource->GetResourceType() != Material_Resource)
+				continue;
+
+			auto material = static_pointer_cast<Material>(resource);
+			auto model = perModel.find(material->GetModelID());
+			if (model == perModel.end())
+				continue;
+
+			model->second.cpu += material->GetMemoryUsageCPU();
+			model->second.gpu += material->GetMemoryUsageGPU();
+			model->second.count++;
+
+			// A texture that several materials of the model use is counted once
+			for (const auto& texturePath : material->GetTexturePaths())
+			{
+				auto texture = textures.find(FileSystem::NormalizePath(texturePath));
+				if (texture == textures.end() || !modelTextures[model->first].insert(texture->second.get()).second)
+					continue;
+
+				model->second.cpu += texture->second->GetMemoryUsageCPU();
+				model->second.gpu += texture->second->GetMemoryUsageGPU();
+				model->second.count++;
+			}
+		}
+
+		// Totals
+		size_t totalCPU = 0;
+		size_t totalGPU = renderTargets.gpu;
+		vector<MemoryUsage> types = { renderTargets };
+		for (const auto& type : perType)
+		{
+			totalCPU += type.second.cpu;
+			totalGPU += type.second.gpu;
+			types.push_back(type.second);
+		}
+
+		vector<MemoryUsage> models;
+		for (const auto& model : perModel)
+		{
+			models.push_back(model.second);
+		}
+
+		report << "Memory report\n\n";
+		report << "CPU: " << To_String_Precision(totalCPU / 1048576.0f, 2) << " MB\n";
+		report << "GPU: " << To_String_Precision(totalGPU / 1048576.0f, 2) << " MB\n\n";
+		report << "= By type =\n";
+		WriteMemoryUsage(report, types);
+		report << "= By model (meshes, materials and textures; textures shared between models count towards each) =\n";
+		WriteMemoryUsage(report, models);
+		report << "= By resource =\n";
+		WriteMemoryUsage(report, perResource);
+
+		report.close();
+		LOG_INFO("PerformanceProfiler: Memory report written to \"" + filePath + "\".");
+
+		return true;
+	}
+	//=============================================================================================================
+
 	string PerformanceProfiler::To_String_Precision(float value, int decimals)
 	{
 		ostringstream out;
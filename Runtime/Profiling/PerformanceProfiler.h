@@ -34,6 +34,7 @@ namespace Directus
 	class Scene;
 	class Timer;
 	class ResourceManager;
+	class Renderer;
 
 	class DLL_API PerformanceProfiler
 	{
@@ -45,6 +46,14 @@ namespace Directus
 		static void RenderingFinished();
 		static void UpdateMetrics();
 		static const std::string& GetMetrics() { return m_metrics; }
+
+		//= MEMORY ==========================================================================
+		// Memory used by the cached resources and the render targets, as of the last metrics update
+		static size_t GetMemoryUsageCPU() { return m_memoryUsageCPU; }
+		static size_t GetMemoryUsageGPU() { return m_memoryUsageGPU; }
+		// Writes the memory used by every resource, largest first, with totals per type and per model
+		static bool DumpMemoryReport(const std::string& filePath);
+		//===================================================================================
 		
 	private:
 		// Converts float to string with specificed precision
@@ -54,6 +63,8 @@ namespace Directus
 		static float m_renderTimeMs;
 		static int m_renderedMeshesCount;
 		static int m_renderedMeshesPerFrame;
+		static size_t m_memoryUsageCPU;
+		static size_t m_memoryUsageGPU;
 
 		// Settings
 		static float m_updateFrequencyMs;
@@ -67,5 +78,6 @@ namespace Directus
 		static Scene* m_scene;
 		static Timer* m_timer;
 		static ResourceManager* m_resourceManager;
+		static Renderer* m_renderer;
 	};
 }
\ No newline at end of file
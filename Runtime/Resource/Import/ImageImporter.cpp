@@ -23,9 +23,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "ImageImporter.h"
 #include "../../Logging/Log.h"
 #include "../../FileSystem/FileSystem.h"
+#include "../../FileSystem/AssetArchive.h"
 #include "FreeImagePlus.h"
 #include <future>
 #include <functional>
+#include <mutex>
 //======================================
 
 //= NAMESPACES =====
@@ -34,6 +36,10 @@ using namespace std;
 
 namespace Directus
 {
+	// FreeImage is global, so the first importer initialises it and the last one releases it
+	static mutex freeImageMutex;
+	static int freeImageUsers = 0;
+
 	ImageImporter::ImageImporter()
 	{
 		m_bpp = 0;
@@ -45,13 +51,22 @@ namespace Directus
 		m_transparent = false;
 		m_isLoading = false;
 
-		FreeImage_Initialise(true);
+		lock_guard<mutex> lock(freeImageMutex);
+		if (freeImageUsers++ == 0)
+		{
+			FreeImage_Initialise(true);
+		}
 	}
 
 	ImageImporter::~ImageImporter()
 	{
 		Clear();
-		FreeImage_DeInitialise();
+
+		lock_guard<mutex> lock(freeImageMutex);
+		if (--freeImageUsers == 0)
+		{
+			FreeImage_DeInitialise();
+		}
 	}
 
 	void ImageImporter::LoadAsync(const string& filePath)
@@ -73,8 +88,14 @@ namespace Directus
 			return false;
 		}
 
+		// Images in mounted archives decode straight from the archive's memory
+		size_t size = 0;
+		vector<unsigned char> storage;
+		const unsigned char* archived = AssetArchive::GetArchivedData(path, size, storage);
+		FIMEMORY* memory = archived ? FreeImage_OpenMemory(const_cast<BYTE*>(archived), (DWORD)size) : nullptr;
+
 		// Get image format
-		FREE_IMAGE_FORMAT format = FreeImage_GetFileType(path.c_str(), 0);
+		FREE_IMAGE_FORMAT format = memory ? FreeImage_GetFileTypeFromMemory(memory, 0) : FreeImage_GetFileType(path.c_str(), 0);
 
 		// If the format is unknown
 		if (format == FIF_UNKNOWN)
@@ -87,6 +108,7 @@ namespace Directus
 			if (!FreeImage_FIFSupportsReading(format))
 			{
 				LOG_WARNING("Failed to detect the image format.");
+				if (memory) FreeImage_CloseMemory(memory);
 				m_isLoading = false;
 				return false;
 			}
@@ -98,12 +120,17 @@ namespace Directus
 		// but I am checking against it also, just in case.
 		if (format == -1 || format == FIF_UNKNOWN)
 		{
+			if (memory) FreeImage_CloseMemory(memory);
 			m_isLoading = false;
 			return false;
 		}
 
 		// Load the image as a FIBITMAP*
-		FIBITMAP* bitmapOriginal = FreeImage_Load(format, path.c_str());
+		FIBITMAP* bitmapOriginal = memory ? FreeImage_LoadFromMemory(format, memory) : FreeImage_Load(format, path.c_str());
+		if (memory)
+		{
+			FreeImage_CloseMemory(memory);
+		}
 
 		// Flip it vertically
 		FreeImage_FlipVertical(bitmapOriginal);
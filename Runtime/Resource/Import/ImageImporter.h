@@ -62,6 +62,7 @@ XPM files[reading, writing]
 
 //= INCLUDES =================
 #include <vector>
+#include <string>
 #include "../../Core/Helper.h"
 //============================
 
@@ -0,0 +1,362 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+//= INCLUDES =====================
+#include "ImportCache.h"
+#include <fstream>
+#include <cstring>
+#include "../../FileSystem/FileSystem.h"
+#include "../../IO/StreamIO.h"
+#include "../../Logging/Log.h"
+//================================
+
+//= NAMESPACES =====
+using namespace std;
+//==================
+
+#define IMPORT_CACHE_FILE "ImportCache.db"
+#define IMPORT_CACHE_VERSION 3
+
+namespace Directus
+{
+	static const unsigned long long HASH_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+	// The finalizer of splitmix64, spreads every bit of the input over the whole hash
+	static unsigned long long Mix(unsigned long long hash)
+	{
+		hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+		return hash ^ (hash >> 31);
+	}
+
+	// Hashes a file's content 8 bytes at a time, returns false if it can't be read
+	static bool HashFile(const string& filePath, unsigned long long& hash)
+	{
+		ifstream file(filePath, ios::in | ios::binary);
+		if (file.fail())
+			return false;
+
+		hash = 14695981039346656037ULL;
+		unsigned long long length = 0;
+		static const size_t bufferSize = 64 * 1024;
+		unique_ptr<char[]> buffer(new char[bufferSize]);
+		while (file.read(buffer.get(), bufferSize) || file.gcount() > 0)
+		{
+			size_t count = (size_t)file.gcount();
+			size_t wordCount = count / 8;
+			for (size_t i = 0; i < wordCount; i++)
+			{
+				unsigned long long word;
+				memcpy(&word, buffer.get() + i * 8, 8);
+				hash = (hash ^ word) * HASH_MULTIPLIER;
+				hash ^= hash >> 32;
+			}
+
+			// Only the last read can end in the middle of a word
+			size_t tail = count - wordCount * 8;
+			if (tail != 0)
+			{
+				unsigned long long word = 0;
+				memcpy(&word, buffer.get() + wordCount * 8, tail);
+				hash = (hash ^ word) * HASH_MULTIPLIER;
+				hash ^= hash >> 32;
+			}
+			length += count;
+		}
+		hash = Mix(hash ^ length);
+
+		return true;
+	}
+
+	ImportCache::ImportCache()
+	{
+		m_isDirty = false;
+	}
+
+	ImportCache::~ImportCache()
+	{
+		Save();
+	}
+
+	bool ImportCache::Load(const string& directory)
+	{
+		Save();
+
+		lock_guard<mutex> lock(m_mutex);
+		m_entries.clear();
+		m_copies.clear();
+		m_stamps.clear();
+		m_artefactsByKey.clear();
+		m_artefactUsers.clear();
+		m_directory = directory;
+		m_isDirty = false;
+
+		if (!FileSystem::DirectoryExists(m_directory))
+		{
+			FileSystem::CreateDirectory_(m_directory);
+		}
+
+		string databaseFilePath = m_directory + IMPORT_CACHE_FILE;
+		if (!FileSystem::FileExists(databaseFilePath))
+			return true;
+
+		StreamIO stream(databaseFilePath, Stream_Read);
+		if (!stream.IsOpen())
+			return false;
+
+		// A database of an older version is discarded, its artefacts will be re-cooked
+		if (stream.ReadInt() == IMPORT_CACHE_VERSION)
+		{
+			int entryCount = stream.ReadInt();
+			for (int i = 0; i < entryCount; i++)
+			{
+				string sourceFilePath = stream.ReadSTR();
+				Entry& entry = m_entries[sourceFilePath];
+				entry.key = stream.ReadSTR();
+				entry.artefactFilePath = stream.ReadSTR();
+			}
+
+			int copyCount = stream.ReadInt();
+			for (int i = 0; i < copyCount; i++)
+			{
+				string contentKey = stream.ReadSTR();
+				m_copies[contentKey] = stream.ReadSTR();
+			}
+
+			int stampCount = stream.ReadInt();
+			for (int i = 0; i < stampCount && !stream.HasError(); i++)
+			{
+				string filePath = stream.ReadSTR();
+				Stamp& stamp = m_stamps[filePath];
+				stamp.size = stream.ReadULongLong();
+				stamp.writeTime = (long long)stream.ReadULongLong();
+				stamp.contentHash = stream.ReadULongLong();
+			}
+		}
+
+		// Everything is re-cooked rather than trusting a truncated database
+		if (stream.HasError())
+		{
+			LOG_WARNING("ImportCache: \"" + databaseFilePath + "\" is corrupted, discarding it.");
+			m_entries.clear();
+			m_copies.clear();
+			m_stamps.clear();
+		}
+
+		for (const auto& entry : m_entries)
+		{
+			AddArtefactUser(entry.second.key, entry.second.artefactFilePath);
+		}
+
+		return true;
+	}
+
+	bool ImportCache::Save()
+	{
+		lock_guard<mutex> lock(m_mutex);
+		if (!m_isDirty || m_directory.empty())
+			return true;
+
+		StreamIO stream(m_directory + IMPORT_CACHE_FILE, Stream_Write);
+		if (!stream.IsOpen())
+		{
+			LOG_WARNING("ImportCache: Failed to save \"" + m_directory + IMPORT_CACHE_FILE + "\".");
+			return false;
+		}
+
+		stream.WriteInt(IMPORT_CACHE_VERSION);
+		stream.WriteInt((int)m_entries.size());
+		for (const auto& entry : m_entries)
+		{
+			stream.WriteSTR(entry.first);
+			stream.WriteSTR(entry.second.key);
+			stream.WriteSTR(entry.second.artefactFilePath);
+		}
+
+		stream.WriteInt((int)m_copies.size());
+		for (const auto& copy : m_copies)
+		{
+			stream.WriteSTR(copy.first);
+			stream.WriteSTR(copy.second);
+		}
+
+		stream.WriteInt((int)m_stamps.size());
+		for (const auto& stamp : m_stamps)
+		{
+			stream.WriteSTR(stamp.first);
+			stream.WriteULongLong(stamp.second.size);
+			stream.WriteULongLong((unsigned long long)stamp.second.writeTime);
+			stream.WriteULongLong(stamp.second.contentHash);
+		}
+
+		if (!stream.Close())
+		{
+			LOG_WARNING("ImportCache: Failed to save \"" + m_directory + IMPORT_CACHE_FILE + "\".");
+			return false;
+		}
+		m_isDirty = false;
+
+		return true;
+	}
+
+	string ImportCache::ComputeKey(const string& sourceFilePath, unsigned long long settings)
+	{
+		unsigned long long size = 0;
+		long long writeTime = 0;
+		if (!FileSystem::GetFileStamp(sourceFilePath, size, writeTime))
+			return "";
+
+		// Only read the file if it changed since it was last hashed
+		string normalizedPath = FileSystem::NormalizePath(sourceFilePath);
+		unsigned long long contentHash = 0;
+		bool isHashed = false;
+		{
+			lock_guard<mutex> lock(m_mutex);
+			auto it = m_stamps.find(normalizedPath);
+			if (it != m_stamps.end() && it->second.size == size && it->second.writeTime == writeTime)
+			{
+				contentHash = it->second.contentHash;
+				isHashed = true;
+			}
+		}
+
+		// Hash outside of the lock, other imports can go on meanwhile
+		if (!isHashed)
+		{
+			if (!HashFile(sourceFilePath, contentHash))
+				return "";
+
+			lock_guard<mutex> lock(m_mutex);
+			m_stamps[normalizedPath] = Stamp{ size, writeTime, contentHash };
+			m_isDirty = true;
+		}
+
+		char key[17];
+		snprintf(key, sizeof(key), "%016llx", Mix(contentHash ^ Mix(settings + HASH_MULTIPLIER)));
+
+		return key;
+	}
+
+	string ImportCache::Find(const string& sourceFilePath, const string& key)
+	{
+		if (key.empty())
+			return "";
+
+		lock_guard<mutex> lock(m_mutex);
+		auto it = m_entries.find(FileSystem::NormalizePath(sourceFilePath));
+		if (it != m_entries.end() && it->second.key == key && FileSystem::FileExists(it->second.artefactFilePath))
+			return it->second.artefactFilePath;
+
+		// Identical content that was imported from another path shares its artefact, e.g. a
+		// texture that was cooked in the source tree and gets loaded from its project copy.
+		// The artefact might have been deleted by hand.
+		auto byKey = m_artefactsByKey.find(key);
+		if (byKey != m_artefactsByKey.end() && FileSystem::FileExists(byKey->second))
+			return byKey->second;
+
+		return "";
+	}
+
+	void ImportCache::Record(const string& sourceFilePath, const string& key, const string& artefactFilePath)
+	{
+		if (key.empty())
+			return;
+
+		lock_guard<mutex> lock(m_mutex);
+		Entry& entry = m_entries[FileSystem::NormalizePath(sourceFilePath)];
+		if (entry.key == key && entry.artefactFilePath == artefactFilePath)
+			return;
+
+		string previousKey = entry.key;
+		string previous = entry.artefactFilePath;
+		entry.key = key;
+		entry.artefactFilePath = artefactFilePath;
+		AddArtefactUser(key, artefactFilePath);
+		m_isDirty = true;
+
+		if (previous.empty())
+			return;
+
+		// Delete the previous artefact, unless another source still uses it (same content)
+		auto users = m_artefactUsers.find(previous);
+		if (users != m_artefactUsers.end() && --users->second > 0)
+			return;
+
+		m_artefactUsers.erase(previous);
+		auto byKey = m_artefactsByKey.find(previousKey);
+		if (byKey != m_artefactsByKey.end() && byKey->second == previous)
+		{
+			m_artefactsByKey.erase(byKey);
+		}
+
+		if (previous.find(m_directory) == 0)
+		{
+			FileSystem::DeleteFile_(previous);
+		}
+	}
+
+	string ImportCache::FindCopy(const string& contentKey)
+	{
+		if (contentKey.empty())
+			return "";
+
+		string copyFilePath;
+		{
+			lock_guard<mutex> lock(m_mutex);
+			auto it = m_copies.find(contentKey);
+			if (it == m_copies.end())
+				return "";
+			copyFilePath = it->second;
+		}
+
+		// The copy might have been edited or deleted since, hash it outside of the lock
+		if (ComputeKey(copyFilePath, 0) == contentKey)
+			return copyFilePath;
+
+		lock_guard<mutex> lock(m_mutex);
+		m_copies.erase(contentKey);
+		m_isDirty = true;
+
+		return "";
+	}
+
+	void ImportCache::RecordCopy(const string& contentKey, const string& copyFilePath)
+	{
+		if (contentKey.empty())
+			return;
+
+		lock_guard<mutex> lock(m_mutex);
+		m_copies[contentKey] = copyFilePath;
+		m_isDirty = true;
+	}
+
+	void ImportCache::AddArtefactUser(const string& key, const string& artefactFilePath)
+	{
+		m_artefactUsers[artefactFilePath]++;
+		m_artefactsByKey[key] = artefactFilePath;
+	}
+
+	string ImportCache::GetArtefactFilePath(const string& key, const string& extension)
+	{
+		return m_directory + key + extension;
+	}
+}
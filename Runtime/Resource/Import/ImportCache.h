@@ -0,0 +1,96 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+#pragma once
+
+//= INCLUDES ==============
+#include <string>
+#include <unordered_map>
+#include <mutex>
+#include "../../Core/Helper.h"
+//=========================
+
+namespace Directus
+{
+	// A persistent database of imported source assets. Each import is keyed by a hash
+	// of the source file's content and the settings it was imported with, so an
+	// unchanged asset can load the engine format artefact of its last import instead.
+	// Content hashes are remembered along with the file's size and last write time,
+	// a file is only read again once either of them changes.
+	class DLL_API ImportCache
+	{
+	public:
+		ImportCache();
+		~ImportCache();
+
+		// Loads the database of a cache directory, saving the current one first
+		bool Load(const std::string& directory);
+		// Saves the database, if anything was recorded since it was last saved
+		bool Save();
+
+		// Returns a key for the source file's content and import settings, empty if the file can't be read
+		std::string ComputeKey(const std::string& sourceFilePath, unsigned long long settings);
+		// Returns the artefact of the source file's last import, or of any import of the same
+		// content and settings, empty if there is none
+		std::string Find(const std::string& sourceFilePath, const std::string& key);
+		// Records an import, deleting the artefact of the previous one. Recording an artefact that
+		// Find() returned keeps it alive for as long as this source uses it, even if it's shared.
+		void Record(const std::string& sourceFilePath, const std::string& key, const std::string& artefactFilePath);
+
+		// Imports that copy source files into the project share the copies of identical content.
+		// Returns the copy of a file whose content key (settings 0) matches, empty if there's none.
+		std::string FindCopy(const std::string& contentKey);
+		// Records a copy of a source file, by the source's content key
+		void RecordCopy(const std::string& contentKey, const std::string& copyFilePath);
+
+		// Returns a path in the cache directory to save the artefact of a key to
+		std::string GetArtefactFilePath(const std::string& key, const std::string& extension);
+		const std::string& GetDirectory() { return m_directory; }
+
+	private:
+		struct Entry
+		{
+			std::string key;
+			std::string artefactFilePath;
+		};
+
+		struct Stamp
+		{
+			unsigned long long size;
+			long long writeTime;
+			unsigned long long contentHash;
+		};
+
+		// Adds an artefact user to the indices, the mutex must be held
+		void AddArtefactUser(const std::string& key, const std::string& artefactFilePath);
+
+		std::unordered_map<std::string, Entry> m_entries;
+		std::unordered_map<std::string, std::string> m_copies;
+		std::unordered_map<std::string, Stamp> m_stamps;
+		// Indices of the entries, by key and by how many sources use an artefact
+		std::unordered_map<std::string, std::string> m_artefactsByKey;
+		std::unordered_map<std::string, int> m_artefactUsers;
+		std::string m_directory;
+		std::mutex m_mutex;
+		bool m_isDirty;
+	};
+}
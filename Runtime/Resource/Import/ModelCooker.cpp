@@ -0,0 +1,602 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+//= INCLUDES ======================
+#include "ModelCooker.h"
+#include <assimp/scene.h>
+#include <assimp/Importer.hpp>
+#include <assimp/postprocess.h>
+#include <unordered_map>
+#include <algorithm>
+#include <cstring>
+#include "ImportCache.h"
+#include "../../FileSystem/FileSystem.h"
+#include "../../IO/StreamIO.h"
+#include "../../Logging/Log.h"
+#include "../../Graphics/Mesh.h"
+#include "../../Math/Matrix.h"
+//=================================
+
+//= NAMESPACES ================
+using namespace std;
+using namespace Directus::Math;
+//=============================
+
+// Things for Assimp to do
+static auto ppsteps =
+aiProcess_CalcTangentSpace |
+aiProcess_GenSmoothNormals |
+aiProcess_JoinIdenticalVertices |
+aiProcess_ImproveCacheLocality |
+aiProcess_LimitBoneWeights |
+aiProcess_SplitLargeMeshes |
+aiProcess_Triangulate |
+aiProcess_GenUVCoords |
+aiProcess_SortByPType |
+aiProcess_FindDegenerates |
+aiProcess_FindInvalidData |
+aiProcess_FindInstances |
+aiProcess_RemoveRedundantMaterials |
+aiProcess_ValidateDataStructure |
+aiProcess_OptimizeMeshes |
+aiProcess_Debone |
+aiProcess_ConvertToLeftHanded;
+
+static int normalSmoothAngle = 80;
+
+namespace Directus
+{
+	//= HELPER FUNCTIONS =============================================
+	Matrix aiMatrix4x4ToMatrix(const aiMatrix4x4& transform)
+	{
+		return Matrix(
+			transform.a1, transform.b1, transform.c1, transform.d1,
+			transform.a2, transform.b2, transform.c2, transform.d2,
+			transform.a3, transform.b3, transform.c3, transform.d3,
+			transform.a4, transform.b4, transform.c4, transform.d4
+		);
+	}
+
+	Vector4 ToVector4(const aiColor4D& aiColor)
+	{
+		return Vector4(aiColor.r, aiColor.g, aiColor.b, aiColor.a);
+	}
+
+	Vector3 ToVector3(const aiVector3D& aiVector)
+	{
+		return Vector3(aiVector.x, aiVector.y, aiVector.z);
+	}
+
+	Vector2 ToVector2(const aiVector2D& aiVector)
+	{
+		return Vector2(aiVector.x, aiVector.y);
+	}
+
+	// 64-bit FNV-1a of a mesh's vertices and indices
+	unsigned long long HashMeshBuffers(const shared_ptr<Mesh>& mesh)
+	{
+		const unsigned long long prime = 1099511628211ULL;
+		unsigned long long hash = 14695981039346656037ULL;
+
+		auto hashBytes = [&hash, prime](const void* data, size_t size)
+		{
+			const unsigned char* bytes = (const unsigned char*)data;
+			for (size_t i = 0; i < size; i++)
+			{
+				hash = (hash ^ bytes[i]) * prime;
+			}
+		};
+		hashBytes(mesh->GetVertices().data(), mesh->GetVertices().size() * sizeof(VertexPosTexTBN));
+		hashBytes(mesh->GetIndices().data(), mesh->GetIndices().size() * sizeof(unsigned int));
+
+		return hash;
+	}
+
+	bool MeshBuffersEqual(const shared_ptr<Mesh>& a, const shared_ptr<Mesh>& b)
+	{
+		auto& verticesA = a->GetVertices();
+		auto& verticesB = b->GetVertices();
+		auto& indicesA = a->GetIndices();
+		auto& indicesB = b->GetIndices();
+
+		return verticesA.size() == verticesB.size() && indicesA.size() == indicesB.size() &&
+			memcmp(verticesA.data(), verticesB.data(), verticesA.size() * sizeof(VertexPosTexTBN)) == 0 &&
+			memcmp(indicesA.data(), indicesB.data(), indicesA.size() * sizeof(unsigned int)) == 0;
+	}
+
+	string TryPathWithMultipleExtensions(const string& filePath)
+	{
+		// Remove extension
+		string filePathNoExt = FileSystem::GetFilePathWithoutExtension(filePath);
+
+		// Check if the file exists using all engine supported extensions
+		auto supportedFormats = FileSystem::GetSupportedImageFormats();
+		for (unsigned int i = 0; i < supportedFormats.size(); i++)
+		{
+			string newFilePath = filePathNoExt + supportedFormats[i];
+			string newFilePathUpper = filePathNoExt + FileSystem::ConvertToUppercase(supportedFormats[i]);
+
+			if (FileSystem::FileExists(newFilePath))
+			{
+				return newFilePath;
+			}
+
+			if (FileSystem::FileExists(newFilePathUpper))
+			{
+				return newFilePathUpper;
+			}
+		}
+
+		return filePath;
+	}
+
+	string FindTexture(const string& modelFilePath, const string& originalTexturePath)
+	{
+		// Models usually return a texture path which is relative to the model's directory.
+		// However, to load anything, we'll need an absolute path, so we construct it here.
+		string modelDir = FileSystem::GetDirectoryFromFilePath(modelFilePath);
+		string fullTexturePath = modelDir + originalTexturePath;
+
+		// 1. Check if the texture path is valid
+		if (FileSystem::FileExists(fullTexturePath))
+			return fullTexturePath;
+
+		// 2. Check the same texture path as previously but 
+		// this time with different file extensions (jpg, png and so on).
+		fullTexturePath = TryPathWithMultipleExtensions(fullTexturePath);
+		if (FileSystem::FileExists(fullTexturePath))
+			return fullTexturePath;
+
+		// At this point we know the provided path is wrong, we will make a few guesses.
+		// The most common mistake is that the artist provided a path which is absolute to his computer.
+
+		// 3. Check if the texture is in the same folder as the model
+		fullTexturePath = modelDir + FileSystem::GetFileNameFromFilePath(fullTexturePath);
+		if (FileSystem::FileExists(fullTexturePath))
+			return fullTexturePath;
+
+		// 4. Check the same texture path as previously but 
+		// this time with different file extensions (jpg, png and so on).
+		fullTexturePath = TryPathWithMultipleExtensions(fullTexturePath);
+		if (FileSystem::FileExists(fullTexturePath))
+			return fullTexturePath;
+
+		// Give up, no valid texture path was found
+		return NOT_ASSIGNED;
+	}
+	//================================================================
+
+	// The state of one import, so that any number of models can be imported at the same time
+	class ModelReader
+	{
+	public:
+		ModelReader(const string& filePath, const aiScene* scene, CookedModel& model) : m_filePath(filePath), m_scene(scene), m_model(model) {}
+
+		void ReadNode(aiNode* assimpNode, const string& name)
+		{
+			CookedNode node;
+			node.name = name;
+
+			// Decompose the transformation matrix
+			Matrix transform = aiMatrix4x4ToMatrix(assimpNode->mTransformation);
+			transform.Decompose(node.scale, node.rotation, node.position);
+
+			// If this node has many meshes, then each one of them gets a child node
+			bool hasMeshChildren = assimpNode->mNumMeshes > 1;
+			node.childCount = (hasMeshChildren ? assimpNode->mNumMeshes : 0) + assimpNode->mNumChildren;
+			if (assimpNode->mNumMeshes == 1)
+			{
+				ReadMesh(m_scene->mMeshes[assimpNode->mMeshes[0]], node);
+			}
+			m_model.nodes.push_back(node);
+
+			for (unsigned int i = 0; hasMeshChildren && i < assimpNode->mNumMeshes; i++)
+			{
+				CookedNode meshNode;
+				meshNode.name = string(assimpNode->mName.C_Str()) + "_" + to_string(i + 1);
+				ReadMesh(m_scene->mMeshes[assimpNode->mMeshes[i]], meshNode);
+				m_model.nodes.push_back(meshNode);
+			}
+
+			// Process children
+			for (unsigned int i = 0; i < assimpNode->mNumChildren; i++)
+			{
+				ReadNode(assimpNode->mChildren[i], assimpNode->mChildren[i]->mName.C_Str());
+			}
+		}
+
+		void ReadAnimations()
+		{
+			for (unsigned int i = 0; i < m_scene->mNumAnimations; i++)
+			{
+				aiAnimation* assimpAnimation = m_scene->mAnimations[i];
+
+				CookedAnimation animation;
+				animation.name = assimpAnimation->mName.C_Str();
+				animation.duration = assimpAnimation->mDuration;
+				animation.ticksPerSec = assimpAnimation->mTicksPerSecond != 0.0f ? assimpAnimation->mTicksPerSecond : 25.0f;
+				m_model.animations.push_back(animation);
+			}
+		}
+
+	private:
+		void ReadMesh(aiMesh* assimpMesh, CookedNode& node)
+		{
+			auto mesh = make_shared<Mesh>();
+			mesh->SetName(assimpMesh->mName.C_Str());
+			ReadVertices(assimpMesh, mesh);
+			ReadIndices(assimpMesh, mesh);
+			mesh->Update(); // counts and bounding box, they are what gets saved
+
+			// Meshes with identical buffers (instances, or the same geometry with another material) share one
+			auto& candidates = m_meshes[HashMeshBuffers(mesh)];
+			auto duplicate = find_if(candidates.begin(), candidates.end(), [this, &mesh](int candidate) { return MeshBuffersEqual(m_model.meshes[candidate], mesh); });
+			if (duplicate != candidates.end())
+			{
+				node.mesh = *duplicate;
+			}
+			else
+			{
+				node.mesh = (int)m_model.meshes.size();
+				candidates.push_back(node.mesh);
+				m_model.meshes.push_back(mesh);
+			}
+
+			// Material, cooked once per assimp material
+			if (m_scene->HasMaterials())
+			{
+				auto it = m_materials.find(assimpMesh->mMaterialIndex);
+				if (it == m_materials.end())
+				{
+					it = m_materials.insert(make_pair(assimpMesh->mMaterialIndex, (int)m_model.materials.size())).first;
+					m_model.materials.push_back(ReadMaterial(m_scene->mMaterials[assimpMesh->mMaterialIndex]));
+				}
+				node.material = it->second;
+			}
+		}
+
+		void ReadIndices(aiMesh* assimpMesh, const shared_ptr<Mesh>& mesh)
+		{
+			// Get indices by iterating through each face of the mesh.
+			for (unsigned int faceIndex = 0; faceIndex < assimpMesh->mNumFaces; faceIndex++)
+			{
+				aiFace face = assimpMesh->mFaces[faceIndex];
+
+				if (face.mNumIndices < 3)
+					continue;
+
+				for (unsigned int j = 0; j < face.mNumIndices; j++)
+				{
+					mesh->AddIndex(face.mIndices[j]);
+				}
+			}
+		}
+
+		void ReadVertices(aiMesh* assimpMesh, const shared_ptr<Mesh>& mesh)
+		{
+			VertexPosTexTBN vertex;
+			for (unsigned int vertexIndex = 0; vertexIndex < assimpMesh->mNumVertices; vertexIndex++)
+			{
+				// Position
+				vertex.position = ToVector3(assimpMesh->mVertices[vertexIndex]);
+
+				// Normal
+				if (assimpMesh->mNormals)
+				{
+					vertex.normal = ToVector3(assimpMesh->mNormals[vertexIndex]);
+				}
+
+				// Tangent
+				if (assimpMesh->mTangents)
+				{
+					vertex.tangent = ToVector3(assimpMesh->mTangents[vertexIndex]);
+				}
+
+				// Bitagent
+				if (assimpMesh->mBitangents)
+				{
+					vertex.bitangent = ToVector3(assimpMesh->mBitangents[vertexIndex]);
+				}
+
+				// Texture Coordinates
+				if (assimpMesh->HasTextureCoords(0))
+				{
+					vertex.uv = ToVector2(aiVector2D(assimpMesh->mTextureCoords[0][vertexIndex].x, assimpMesh->mTextureCoords[0][vertexIndex].y));
+				}
+
+				// save the vertex
+				mesh->AddVertex(vertex);
+
+				// reset the vertex for use in the next loop
+				vertex.normal = Vector3::Zero;
+				vertex.tangent = Vector3::Zero;
+				vertex.uv = Vector2::Zero;
+			}
+		}
+
+		CookedMaterial ReadMaterial(aiMaterial* assimpMaterial)
+		{
+			CookedMaterial material;
+
+			//= NAME ============================================
+			aiString name;
+			aiGetMaterialString(assimpMaterial, AI_MATKEY_NAME, &name);
+			material.name = name.C_Str();
+
+			//= CullMode ===================================================
+			// Specifies whether meshes using this material must be rendered 
+			// without back face CullMode. 0 for false, !0 for true.
+			bool isTwoSided = false;
+			int r = assimpMaterial->Get(AI_MATKEY_TWOSIDED, isTwoSided);
+			material.isTwoSided = r == aiReturn_SUCCESS && isTwoSided;
+
+			//= DIFFUSE COLOR ===================================================
+			aiColor4D colorDiffuse(1.0f, 1.0f, 1.0f, 1.0f);
+			aiGetMaterialColor(assimpMaterial, AI_MATKEY_COLOR_DIFFUSE, &colorDiffuse);
+			material.colorAlbedo = ToVector4(colorDiffuse);
+
+			//= OPACITY ==============================================
+			aiColor4D opacity(1.0f, 1.0f, 1.0f, 1.0f);
+			aiGetMaterialColor(assimpMaterial, AI_MATKEY_OPACITY, &opacity);
+			material.opacity = opacity.r;
+
+			//= TEXTURES ==============================================
+			// Specular is used as roughness, ambient as metallic and lightmap as occlusion
+			ReadTexture(assimpMaterial, aiTextureType_DIFFUSE, Albedo_Texture, material);
+			ReadTexture(assimpMaterial, aiTextureType_SHININESS, Roughness_Texture, material);
+			ReadTexture(assimpMaterial, aiTextureType_AMBIENT, Metallic_Texture, material);
+			ReadTexture(assimpMaterial, aiTextureType_NORMALS, Normal_Texture, material);
+			ReadTexture(assimpMaterial, aiTextureType_LIGHTMAP, Occlusion_Texture, material);
+			ReadTexture(assimpMaterial, aiTextureType_EMISSIVE, Emission_Texture, material);
+			ReadTexture(assimpMaterial, aiTextureType_HEIGHT, Height_Texture, material);
+			ReadTexture(assimpMaterial, aiTextureType_OPACITY, Mask_Texture, material);
+
+			return material;
+		}
+
+		void ReadTexture(aiMaterial* assimpMaterial, aiTextureType assimpType, TextureType type, CookedMaterial& material)
+		{
+			aiString texturePath;
+			if (assimpMaterial->GetTextureCount(assimpType) == 0)
+				return;
+
+			if (assimpMaterial->GetTexture(assimpType, 0, &texturePath, nullptr, nullptr, nullptr, nullptr, nullptr) != AI_SUCCESS)
+				return;
+
+			// FIX: materials that have a diffuse texture should not be tinted black/grey
+			if (type == Albedo_Texture)
+			{
+				material.colorAlbedo = Vector4(1.0f, 1.0f, 1.0f, 1.0f);
+			}
+
+			string filePath = FindTexture(m_filePath, texturePath.data);
+			if (filePath == NOT_ASSIGNED)
+			{
+				LOG_WARNING("ModelCooker: Failed to find model requested texture \"" + string(texturePath.data) + "\".");
+				return;
+			}
+			material.textures.push_back(make_pair(type, filePath));
+		}
+
+		const string& m_filePath;
+		const aiScene* m_scene;
+		CookedModel& m_model;
+
+		// What was cooked so far, to share instead of duplicate
+		unordered_map<unsigned long long, vector<int>> m_meshes;
+		unordered_map<unsigned int, int> m_materials;
+	};
+
+	string ModelCooker::ComputeKey(ImportCache* importCache, const string& filePath)
+	{
+		unsigned long long settings = ((unsigned long long)MODEL_COOK_VERSION << 40) | ((unsigned long long)normalSmoothAngle << 32) | (unsigned int)ppsteps;
+		return importCache->ComputeKey(filePath, settings);
+	}
+
+	bool ModelCooker::Import(const string& filePath, CookedModel& model)
+	{
+		// Set up an Assimp importer
+		Assimp::Importer importer;
+		importer.SetPropertyInteger(AI_CONFIG_PP_ICL_PTCACHE_SIZE, 64); // Optimize mesh
+		importer.SetPropertyInteger(AI_CONFIG_PP_SBP_REMOVE, aiPrimitiveType_LINE | aiPrimitiveType_POINT); // Remove points and lines.
+		importer.SetPropertyInteger(AI_CONFIG_PP_RVC_FLAGS, aiComponent_CAMERAS | aiComponent_LIGHTS); // Remove cameras and lights
+		importer.SetPropertyInteger(AI_CONFIG_PP_CT_MAX_SMOOTHING_ANGLE, normalSmoothAngle); // Default is 45, max is 175
+
+		// Read the 3D model file from disk
+		const aiScene* scene = importer.ReadFile(filePath, ppsteps);
+		if (!scene)
+		{
+			LOG_ERROR("Failed to load \"" + FileSystem::GetFileNameNoExtensionFromFilePath(filePath) + "\". " + importer.GetErrorString());
+			return false;
+		}
+
+		// Note: The root node's name is "RootNode", a more descriptive name comes from the file path
+		ModelReader reader(filePath, scene, model);
+		reader.ReadNode(scene->mRootNode, FileSystem::GetFileNameNoExtensionFromFilePath(filePath));
+		reader.ReadAnimations();
+
+		return true;
+	}
+
+	bool ModelCooker::Save(const string& filePath, const CookedModel& model)
+	{
+		StreamIO stream(filePath, Stream_Write);
+		if (!stream.IsOpen())
+			return false;
+
+		stream.WriteInt((int)model.nodes.size());
+		for (const auto& node : model.nodes)
+		{
+			stream.WriteSTR(node.name);
+			stream.WriteVector3(node.position);
+			stream.WriteQuaternion(node.rotation);
+			stream.WriteVector3(node.scale);
+			stream.WriteInt(node.mesh);
+			stream.WriteInt(node.material);
+			stream.WriteInt(node.childCount);
+		}
+
+		stream.WriteInt((int)model.materials.size());
+		for (const auto& material : model.materials)
+		{
+			stream.WriteSTR(material.name);
+			stream.WriteBool(material.isTwoSided);
+			stream.WriteVector4(material.colorAlbedo);
+			stream.WriteFloat(material.opacity);
+			stream.WriteInt((int)material.textures.size());
+			for (const auto& texture : material.textures)
+			{
+				stream.WriteInt((int)texture.first);
+				stream.WriteSTR(texture.second);
+			}
+		}
+
+		stream.WriteInt((int)model.animations.size());
+		for (const auto& animation : model.animations)
+		{
+			stream.WriteSTR(animation.name);
+			stream.WriteFloat((float)animation.duration);
+			stream.WriteFloat((float)animation.ticksPerSec);
+		}
+
+		stream.WriteInt((int)model.meshes.size());
+		for (const auto& mesh : model.meshes)
+		{
+			mesh->Serialize(&stream);
+		}
+
+		return stream.Close();
+	}
+
+	bool ModelCooker::Load(const string& filePath, CookedModel& model)
+	{
+		StreamIO stream(filePath, Stream_Read);
+		if (!stream.IsOpen())
+			return false;
+
+		// Counts come from the file, a corrupted one stops at the end of the data instead of allocating them
+		int nodeCount = stream.ReadInt();
+		for (int i = 0; i < nodeCount && !stream.HasError(); i++)
+		{
+			CookedNode node;
+			node.name = stream.ReadSTR();
+			node.position = stream.ReadVector3();
+			node.rotation = stream.ReadQuaternion();
+			node.scale = stream.ReadVector3();
+			node.mesh = stream.ReadInt();
+			node.material = stream.ReadInt();
+			node.childCount = stream.ReadInt();
+			model.nodes.push_back(node);
+		}
+
+		int materialCount = stream.ReadInt();
+		for (int i = 0; i < materialCount && !stream.HasError(); i++)
+		{
+			CookedMaterial material;
+			material.name = stream.ReadSTR();
+			material.isTwoSided = stream.ReadBool();
+			material.colorAlbedo = stream.ReadVector4();
+			material.opacity = stream.ReadFloat();
+			int textureCount = stream.ReadInt();
+			for (int j = 0; j < textureCount && !stream.HasError(); j++)
+			{
+				TextureType type = (TextureType)stream.ReadInt();
+				material.textures.push_back(make_pair(type, stream.ReadSTR()));
+			}
+			model.materials.push_back(material);
+		}
+
+		int animationCount = stream.ReadInt();
+		for (int i = 0; i < animationCount && !stream.HasError(); i++)
+		{
+			CookedAnimation animation;
+			animation.name = stream.ReadSTR();
+			animation.duration = stream.ReadFloat();
+			animation.ticksPerSec = stream.ReadFloat();
+			model.animations.push_back(animation);
+		}
+
+		int meshCount = stream.ReadInt();
+		for (int i = 0; i < meshCount && !stream.HasError(); i++)
+		{
+			auto mesh = make_shared<Mesh>();
+			mesh->Deserialize(&stream);
+			model.meshes.push_back(mesh);
+		}
+
+		if (stream.HasError())
+			return false;
+
+		// The nodes have to form a single hierarchy and refer to what was read
+		int pending = 1;
+		for (const auto& node : model.nodes)
+		{
+			bool isMeshValid = node.mesh >= -1 && node.mesh < (int)model.meshes.size();
+			bool isMaterialValid = node.material >= -1 && node.material < (int)model.materials.size();
+			if (pending <= 0 || node.childCount < 0 || node.childCount > (int)model.nodes.size() || !isMeshValid || !isMaterialValid)
+				return false;
+			pending += node.childCount - 1;
+		}
+
+		return !model.nodes.empty() && pending == 0;
+	}
+
+	string ModelCooker::Cook(ImportCache* importCache, const string& filePath, bool* upToDate)
+	{
+		if (upToDate)
+		{
+			*upToDate = false;
+		}
+
+		string key = ComputeKey(importCache, filePath);
+		if (key.empty())
+		{
+			LOG_WARNING("ModelCooker: Can't read \"" + filePath + "\".");
+			return "";
+		}
+
+		string artefact = importCache->Find(filePath, key);
+		if (!artefact.empty())
+		{
+			importCache->Record(filePath, key, artefact);
+			if (upToDate)
+			{
+				*upToDate = true;
+			}
+			return artefact;
+		}
+
+		CookedModel model;
+		if (!Import(filePath, model))
+			return "";
+
+		artefact = importCache->GetArtefactFilePath(key, MODEL_IMPORT_EXTENSION);
+		if (!Save(artefact, model))
+		{
+			LOG_WARNING("ModelCooker: Failed to save \"" + artefact + "\".");
+			return "";
+		}
+		importCache->Record(filePath, key, artefact);
+
+		return artefact;
+	}
+}
@@ -0,0 +1,99 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+#pragma once
+
+//= INCLUDES ====================
+#include <string>
+#include <vector>
+#include <memory>
+#include "../../Core/Helper.h"
+#include "../../Graphics/Texture.h"
+#include "../../Math/Vector3.h"
+#include "../../Math/Vector4.h"
+#include "../../Math/Quaternion.h"
+//===============================
+
+// Bump when the cooked model layout or the import settings change, so that old artefacts get re-cooked
+#define MODEL_COOK_VERSION 1
+
+namespace Directus
+{
+	class ImportCache;
+	class Mesh;
+
+	// A GameObject of a cooked model, in the order the hierarchy is walked
+	struct CookedNode
+	{
+		std::string name;
+		Math::Vector3 position;
+		Math::Quaternion rotation;
+		Math::Vector3 scale = Math::Vector3::One;
+		int mesh = -1;
+		int material = -1;
+		int childCount = 0;
+	};
+
+	// A material of a cooked model, its textures are the source files the model refers to
+	struct CookedMaterial
+	{
+		std::string name;
+		bool isTwoSided = false;
+		Math::Vector4 colorAlbedo = Math::Vector4(1.0f);
+		float opacity = 1.0f;
+		std::vector<std::pair<TextureType, std::string>> textures;
+	};
+
+	struct CookedAnimation
+	{
+		std::string name;
+		double duration = 0.0;
+		double ticksPerSec = 0.0;
+	};
+
+	// Everything a source model imports to, before any of it is added to a scene
+	struct CookedModel
+	{
+		std::vector<CookedNode> nodes;
+		std::vector<CookedMaterial> materials;
+		std::vector<std::shared_ptr<Mesh>> meshes;
+		std::vector<CookedAnimation> animations;
+	};
+
+	// Imports source models with Assimp to meshes, materials and a hierarchy, which the ModelImporter
+	// then turns into GameObjects. It doesn't need a graphics device or a scene, so models can be
+	// cooked offline as well as on load.
+	class DLL_API ModelCooker
+	{
+	public:
+		// Returns the import cache key of a source model, empty if the file can't be read
+		static std::string ComputeKey(ImportCache* importCache, const std::string& filePath);
+		// Imports a source model, false if Assimp can't read it
+		static bool Import(const std::string& filePath, CookedModel& model);
+		// Writes and reads cooked model files
+		static bool Save(const std::string& filePath, const CookedModel& model);
+		static bool Load(const std::string& filePath, CookedModel& model);
+		// Imports and cooks a source model into the import cache, unless it's up to date already.
+		// Returns the cooked model's path, empty on failure.
+		static std::string Cook(ImportCache* importCache, const std::string& filePath, bool* upToDate = nullptr);
+	};
+}
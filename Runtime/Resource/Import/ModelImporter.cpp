@@ -19,12 +19,12 @@ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
 CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
+
 //= INCLUDES ======================================
 #include "ModelImporter.h"
-#include <assimp/scene.h>
-#include <assimp/Importer.hpp>
-#include <assimp/postprocess.h>
 #include <vector>
+#include "ModelCooker.h"
+#include "ImportCache.h"
 #include "../../Core/Scene.h"
 #include "../../Core/GameObject.h"
 #include "../../Core/Context.h"
@@ -45,83 +45,8 @@ using namespace std;
 using namespace Directus::Math;
 //=============================
 
-// Things for Assimp to do
-static auto ppsteps =
-aiProcess_CalcTangentSpace |
-aiProcess_GenSmoothNormals |
-aiProcess_JoinIdenticalVertices |
-aiProcess_ImproveCacheLocality |
-aiProcess_LimitBoneWeights |
-aiProcess_SplitLargeMeshes |
-aiProcess_Triangulate |
-aiProcess_GenUVCoords |
-aiProcess_SortByPType |
-aiProcess_FindDegenerates |
-aiProcess_FindInvalidData |
-aiProcess_FindInstances |
-aiProcess_ValidateDataStructure |
-aiProcess_OptimizeMeshes |
-aiProcess_Debone |
-aiProcess_ConvertToLeftHanded;
-
-static int normalSmoothAngle = 80;
-
 namespace Directus
 {
-	//= HELPER FUNCTIONS =============================================
-	Matrix aiMatrix4x4ToMatrix(const aiMatrix4x4& transform)
-	{
-		return Matrix(
-			transform.a1, transform.b1, transform.c1, transform.d1,
-			transform.a2, transform.b2, transform.c2, transform.d2,
-			transform.a3, transform.b3, transform.c3, transform.d3,
-			transform.a4, transform.b4, transform.c4, transform.d4
-		);
-	}
-
-	void SetGameObjectTransform(weakGameObj gameObject, aiNode* node)
-	{
-		if (gameObject.expired())
-			return;
-
-		aiMatrix4x4 mAssimp = node->mTransformation;
-		Vector3 position;
-		Quaternion rotation;
-		Vector3 scale;
-
-		// Decompose the transformation matrix
-		Matrix mEngine = aiMatrix4x4ToMatrix(mAssimp);
-		mEngine.Decompose(scale, rotation, position);
-
-		// Apply position, rotation and scale
-		gameObject._Get()->GetTransform()->SetPositionLocal(position);
-		gameObject._Get()->GetTransform()->SetRotationLocal(rotation);
-		gameObject._Get()->GetTransform()->SetScaleLocal(scale);
-	}
-
-	Vector4 ToVector4(const aiColor4D& aiColor)
-	{
-		return Vector4(aiColor.r, aiColor.g, aiColor.b, aiColor.a);
-	}
-
-	Vector3 ToVector3(const aiVector3D& aiVector)
-	{
-		return Vector3(aiVector.x, aiVector.y, aiVector.z);
-	}
-
-	Vector2 ToVector2(const aiVector2D& aiVector)
-	{
-		return Vector2(aiVector.x, aiVector.y);
-	}
-
-	Quaternion ToQuaternion(const aiQuaternion& aiQuaternion)
-	{
-		return Quaternion(aiQuaternion.x, aiQuaternion.y, aiQuaternion.z, aiQuaternion.w);
-	}
-	//==================================================================
-
-	vector<string> materialNames;
-
 	ModelImporter::ModelImporter(Context* context)
 	{
 		m_context = context;
@@ -154,32 +79,39 @@ namespace Directus
 		m_modelPath = filePath;
 		m_isLoading = true;
 
-		// Set up an Assimp importer
-		Assimp::Importer importer;
-		importer.SetPropertyInteger(AI_CONFIG_PP_ICL_PTCACHE_SIZE, 64); // Optimize mesh
-		importer.SetPropertyInteger(AI_CONFIG_PP_SBP_REMOVE, aiPrimitiveType_LINE | aiPrimitiveType_POINT); // Remove points and lines.
-		importer.SetPropertyInteger(AI_CONFIG_PP_RVC_FLAGS, aiComponent_CAMERAS | aiComponent_LIGHTS); // Remove cameras and lights
-		importer.SetPropertyInteger(AI_CONFIG_PP_CT_MAX_SMOOTHING_ANGLE, normalSmoothAngle); // Default is 45, max is 175
-
-		// Read the 3D model file from disk
-		m_status = "Loading \"" + FileSystem::GetFileNameFromFilePath(filePath) +"\" from disk...";
-		const aiScene* scene = importer.ReadFile(m_modelPath, ppsteps);
-		if (!scene)
+		// An unchanged model loads the cooked result of its last import instead of running Assimp
+		auto importCache = m_context->GetSubsystem<ResourceManager>()->GetImportCache();
+		string key = ModelCooker::ComputeKey(importCache._Get(), filePath);
+		string artefact = importCache._Get()->Find(filePath, key);
+
+		CookedModel cooked;
+		if (!artefact.empty() && ModelCooker::Load(artefact, cooked))
 		{
-			LOG_ERROR("Failed to load \"" + model->GetResourceName() + "\". " + importer.GetErrorString());
-			m_isLoading = false;
-			return false;
+			importCache._Get()->Record(filePath, key, artefact);
+		}
+		else
+		{
+			// Read the 3D model file from disk
+			m_status = "Loading \"" + FileSystem::GetFileNameFromFilePath(filePath) + "\" from disk...";
+			cooked = CookedModel();
+			if (!ModelCooker::Import(filePath, cooked))
+			{
+				m_isLoading = false;
+				return false;
+			}
+
+			artefact = importCache._Get()->GetArtefactFilePath(key, MODEL_IMPORT_EXTENSION);
+			if (ModelCooker::Save(artefact, cooked))
+			{
+				importCache._Get()->Record(filePath, key, artefact);
+			}
 		}
 
 		// Map all the nodes as GameObjects while mentaining hierarchical relationships
 		// as well as their properties (meshes, materials, textures etc.).
-		ReadNodeHierarchy(model, scene, scene->mRootNode, weakGameObj(), weakGameObj());
-
-		// Load animation (in case there are any)
-		ReadAnimations(model, scene);
+		CreateFromCooked(model, cooked);
 
 		// Cleanup
-		importer.FreeScene();
 		m_isLoading = false;
 		ResetStats();
 
@@ -187,352 +119,116 @@ namespace Directus
 	}
 
 	//= PROCESSING ===============================================================================
-	void ModelImporter::ReadNodeHierarchy(Model* model, const aiScene* assimpScene, aiNode* assimpNode, const weak_ptr<GameObject>& parentNode, weak_ptr<GameObject>& newNode)
+	void ModelImporter::CreateFromCooked(Model* model, const CookedModel& cooked)
 	{
-		// Get scene here because it's used below
-		Scene* scene = m_context->GetSubsystem<Scene>();
-
-		// Is this the root node?
-		if (!assimpNode->mParent || newNode.expired())
-		{
-			newNode = scene->CreateGameObject();
-			model->SetRootGameObject(newNode.lock());
-
-			CalculateNodeCount(assimpNode, m_stateNodeCount);
-		}
-
-		m_stateNodeCurrent++;
-
-		//= GET NODE NAME ============================================================
-		// Note: In case this is the root node, aiNode.mName will be "RootNode". 
-		// To get a more descriptive name we instead get the name from the file path.
-		if (assimpNode->mParent)
-		{
-			string name = assimpNode->mName.C_Str();
-			newNode._Get()->SetName(name);
-
-			m_status = "Processing: " + name;
-		}
-		else
+		// Materials, created once each
+		vector<shared_ptr<Material>> materials;
+		for (const auto& cookedMaterial : cooked.materials)
 		{
-			string name = FileSystem::GetFileNameNoExtensionFromFilePath(m_modelPath);
-			newNode._Get()->SetName(name);
-
-			m_status = "Processing: " + name;
+			auto material = CreateMaterial(model, cookedMaterial);
+			model->AddMaterialAsNewResource(material);
+			materials.push_back(material);
 		}
-		//============================================================================
-
-		// Set the transform of parentNode as the parent of the newNode's transform
-		Transform* parentTrans = !parentNode.expired() ? parentNode._Get()->GetTransform() : nullptr;
-		newNode._Get()->GetTransform()->SetParent(parentTrans);
-
-		// Set the transformation matrix of the assimp node to the new node
-		SetGameObjectTransform(newNode, assimpNode);
 
-		// Process all the node's meshes
-		for (unsigned int i = 0; i < assimpNode->mNumMeshes; i++)
+		// The GameObjects get new IDs, the meshes are pointed to them and to the model
+		Scene* scene = m_context->GetSubsystem<Scene>();
+		m_stateNodeCount = (int)cooked.nodes.size();
+		vector<bool> isMeshAdded(cooked.meshes.size(), false);
+		vector<pair<Transform*, int>> parents; // parent and the children it has left to create
+		for (const auto& node : cooked.nodes)
 		{
-			weakGameObj gameobject = newNode; // set the current gameobject
-			aiMesh* mesh = assimpScene->mMeshes[assimpNode->mMeshes[i]]; // get mesh
-			string name = assimpNode->mName.C_Str(); // get name
+			m_stateNodeCurrent++;
+			m_status = "Processing: " + node.name;
 
-			// if this node has many meshes, then assign a new gameobject for each one of them
-			if (assimpNode->mNumMeshes > 1)
+			weakGameObj gameObject = scene->CreateGameObject();
+			if (parents.empty())
 			{
-				gameobject = scene->CreateGameObject(); // create
-				gameobject._Get()->GetTransform()->SetParent(newNode._Get()->GetTransform()); // set parent
-				name += "_" + to_string(i + 1); // set name
+				model->SetRootGameObject(gameObject);
 			}
 
-			// Set gameobject name
-			gameobject._Get()->SetName(name);
-
-			// Process mesh
-			LoadMesh(model, mesh, assimpScene, gameobject);
-		}
-
-		// Process children
-		for (unsigned int i = 0; i < assimpNode->mNumChildren; i++)
-		{
-			weakGameObj child = scene->CreateGameObject();
-			ReadNodeHierarchy(model, assimpScene, assimpNode->mChildren[i], newNode, child);
-		}
-	}
-
-	void ModelImporter::ReadAnimations(Model* model, const aiScene* scene)
-	{
-		for (unsigned int i = 0; i < scene->mNumAnimations; i++)
-		{
-			aiAnimation* assimpAnimation = scene->mAnimations[i];
-			shared_ptr<Animation> animation = make_shared<Animation>();
-
-			// Basic properties
-			animation->SetName(assimpAnimation->mName.C_Str());
-			animation->SetDuration(assimpAnimation->mDuration);
-			animation->SetTicksPerSec(assimpAnimation->mTicksPerSecond != 0.0f ? assimpAnimation->mTicksPerSecond : 25.0f);
+			Transform* transform = gameObject._Get()->GetTransform();
+			gameObject._Get()->SetName(node.name);
+			transform->SetParent(!parents.empty() ? parents.back().first : nullptr);
+			transform->SetPositionLocal(node.position);
+			transform->SetRotationLocal(node.rotation);
+			transform->SetScaleLocal(node.scale);
 
-			// Animation channels
-			for (unsigned int j = 0; j > assimpAnimation->mNumChannels; j++)
+			if (node.mesh != -1)
 			{
-				aiNodeAnim* assimpNodeAnim = assimpAnimation->mChannels[j];
-				AnimationNode animationNode;
-
-				animationNode.name = assimpNodeAnim->mNodeName.C_Str();
-
-				// Position keys
-				for (unsigned int k = 0; k < assimpNodeAnim->mNumPositionKeys; k++)
-				{
-					double time = assimpNodeAnim->mPositionKeys[k].mTime;
-					Vector3 value = ToVector3(assimpNodeAnim->mPositionKeys[k].mValue);
-
-					animationNode.positionFrames.push_back(KeyVector{ time, value });
-				}
-
-				// Rotation keys
-				for (unsigned int k = 0; k < assimpNodeAnim->mNumRotationKeys; k++)
+				// Shared meshes are added once, they belong to the first GameObject that uses them
+				const auto& mesh = cooked.meshes[node.mesh];
+				if (!isMeshAdded[node.mesh])
 				{
-					double time = assimpNodeAnim->mPositionKeys[k].mTime;
-					Quaternion value = ToQuaternion(assimpNodeAnim->mRotationKeys[k].mValue);
-
-					animationNode.rotationFrames.push_back(KeyQuaternion{ time, value });
+					mesh->SetModelID(model->GetResourceID());
+					mesh->SetGameObjectID(gameObject._Get()->GetID());
+					model->AddMeshAsNewResource(mesh);
+					isMeshAdded[node.mesh] = true;
 				}
 
-				// Scaling keys
-				for (unsigned int k = 0; k < assimpNodeAnim->mNumScalingKeys; k++)
-				{
-					double time = assimpNodeAnim->mPositionKeys[k].mTime;
-					Vector3 value = ToVector3(assimpNodeAnim->mScalingKeys[k].mValue);
+				MeshFilter* meshFilter = gameObject._Get()->AddComponent<MeshFilter>();
+				MeshRenderer* meshRenderer = gameObject._Get()->AddComponent<MeshRenderer>();
 
-					animationNode.scaleFrames.push_back(KeyVector{ time, value });
-				}
+				meshFilter->SetMesh(mesh);
+				meshRenderer->SetMaterialFromMemory(node.material != -1 ? materials[node.material] : shared_ptr<Material>());
 			}
 
-			model->AddAnimationAsNewResource(animation);
-		}
-	}
-
-	void ModelImporter::LoadMesh(Model* model, aiMesh* assimpMesh, const aiScene* assimpScene, const weak_ptr<GameObject>& gameobject)
-	{
-		if (gameobject.expired())
-			return;
-
-		// Create a new Mesh
-		shared_ptr<Mesh> mesh = make_shared<Mesh>();
-		mesh->SetModelID(model->GetResourceID());
-		mesh->SetGameObjectID(gameobject._Get()->GetID());
-		mesh->SetName(assimpMesh->mName.C_Str());
-
-		// Vertices
-		LoadAiMeshVertices(assimpMesh, mesh);
-
-		// Indices
-		LoadAiMeshIndices(assimpMesh, mesh);
-
-		// Bones
-		for (unsigned int boneIndex = 0; boneIndex < assimpMesh->mNumBones; boneIndex++)
-		{
-			aiBone* bone = assimpMesh->mBones[boneIndex];
-		}
-
-		// Material
-		shared_ptr<Material> material = shared_ptr<Material>();
-		if (assimpScene->HasMaterials())
-		{
-			aiMaterial* assimpMaterial = assimpScene->mMaterials[assimpMesh->mMaterialIndex];
-			material = AiMaterialToMaterial(model, assimpMaterial);
-		}
-
-		//= Finilize GameObject =====================================================
-		model->AddMeshAsNewResource(mesh);
-		model->AddMaterialAsNewResource(material);
-
-		MeshFilter* meshFilter = gameobject._Get()->AddComponent<MeshFilter>();
-		MeshRenderer* meshRenderer = gameobject._Get()->AddComponent<MeshRenderer>();
-
-		meshFilter->SetMesh(mesh);
-		meshRenderer->SetMaterialFromMemory(material);
-		//===========================================================================
-	}
-
-	void ModelImporter::LoadAiMeshIndices(aiMesh* assimpMesh, shared_ptr<Mesh> mesh)
-	{
-		// Get indices by iterating through each face of the mesh.
-		for (unsigned int faceIndex = 0; faceIndex < assimpMesh->mNumFaces; faceIndex++)
-		{
-			aiFace face = assimpMesh->mFaces[faceIndex];
-
-			if (face.mNumIndices < 3)
-				continue;
-
-			for (unsigned int j = 0; j < face.mNumIndices; j++)
-			{
-				mesh->AddIndex(face.mIndices[j]);
-			}
-		}
-	}
-
-	void ModelImporter::LoadAiMeshVertices(aiMesh* assimpMesh, shared_ptr<Mesh> mesh)
-	{
-		VertexPosTexTBN vertex;
-		for (unsigned int vertexIndex = 0; vertexIndex < assimpMesh->mNumVertices; vertexIndex++)
-		{
-			// Position
-			vertex.position = ToVector3(assimpMesh->mVertices[vertexIndex]);
-
-			// Normal
-			if (assimpMesh->mNormals)
-			{
-				vertex.normal = ToVector3(assimpMesh->mNormals[vertexIndex]);
-			}
-
-			// Tangent
-			if (assimpMesh->mTangents)
+			// Nodes come in the order the hierarchy is walked, so the
+			// next one is a child of the last parent with children left.
+			if (!parents.empty())
 			{
-				vertex.tangent = ToVector3(assimpMesh->mTangents[vertexIndex]);
+				parents.back().second--;
 			}
 
-			// Bitagent
-			if (assimpMesh->mBitangents)
+			if (node.childCount > 0)
 			{
-				vertex.bitangent = ToVector3(assimpMesh->mBitangents[vertexIndex]);
+				parents.push_back(make_pair(transform, node.childCount));
 			}
 
-			// Texture Coordinates
-			if (assimpMesh->HasTextureCoords(0))
+			while (!parents.empty() && parents.back().second == 0)
 			{
-				vertex.uv = ToVector2(aiVector2D(assimpMesh->mTextureCoords[0][vertexIndex].x, assimpMesh->mTextureCoords[0][vertexIndex].y));
+				parents.pop_back();
 			}
+		}
 
-			// save the vertex
-			mesh->AddVertex(vertex);
-
-			// reset the vertex for use in the next loop
-			vertex.normal = Vector3::Zero;
-			vertex.tangent = Vector3::Zero;
-			vertex.uv = Vector2::Zero;
+		// Animations
+		for (const auto& cookedAnimation : cooked.animations)
+		{
+			auto animation = make_shared<Animation>();
+			animation->SetName(cookedAnimation.name);
+			animation->SetDuration(cookedAnimation.duration);
+			animation->SetTicksPerSec(cookedAnimation.ticksPerSec);
+			model->AddAnimationAsNewResource(animation);
 		}
 	}
 
-	shared_ptr<Material> ModelImporter::AiMaterialToMaterial(Model* model, aiMaterial* assimpMaterial)
+	shared_ptr<Material> ModelImporter::CreateMaterial(Model* model, const CookedMaterial& cooked)
 	{
 		auto material = make_shared<Material>(m_context);
-
-		//= NAME ============================================
-		aiString name;
-		aiGetMaterialString(assimpMaterial, AI_MATKEY_NAME, &name);
-		material->SetResourceName(name.C_Str());
+		material->SetResourceName(cooked.name);
 		material->SetModelID(GUIDGenerator::ToUnsignedInt(model->GetResourceName()));
 
-		//= CullMode ===================================================
-		// Specifies whether meshes using this material must be rendered 
-		// without back face CullMode. 0 for false, !0 for true.
-		bool isTwoSided = false;
-		int r = assimpMaterial->Get(AI_MATKEY_TWOSIDED, isTwoSided);
-		if (r == aiReturn_SUCCESS && isTwoSided)
+		if (cooked.isTwoSided)
 		{
 			material->SetCullMode(CullNone);
 		}
+		material->SetColorAlbedo(cooked.colorAlbedo);
+		material->SetOpacity(cooked.opacity);
 
-		//= DIFFUSE COLOR ===================================================
-		aiColor4D colorDiffuse(1.0f, 1.0f, 1.0f, 1.0f);
-		aiGetMaterialColor(assimpMaterial, AI_MATKEY_COLOR_DIFFUSE, &colorDiffuse);
-		material->SetColorAlbedo(ToVector4(colorDiffuse));
-
-		//= OPACITY ==============================================
-		aiColor4D opacity(1.0f, 1.0f, 1.0f, 1.0f);
-		aiGetMaterialColor(assimpMaterial, AI_MATKEY_OPACITY, &opacity);
-		material->SetOpacity(opacity.r);
-
-		//= ALBEDO TEXTURE =============================================================================================================
-		aiString texturePath;
-		if (assimpMaterial->GetTextureCount(aiTextureType_DIFFUSE) > 0)
-		{
-			if (assimpMaterial->GetTexture(aiTextureType_DIFFUSE, 0, &texturePath, nullptr, nullptr, nullptr, nullptr, nullptr) == AI_SUCCESS)
-			{
-				AddTextureToMaterial(model, material, Albedo_Texture, texturePath.data);
-				// FIX: materials that have a diffuse texture should not be tinted black/grey
-				material->SetColorAlbedo(Vector4(1.0f, 1.0f, 1.0f, 1.0f));
-			}
-		}
-
-		//= SPECULAR (used as ROUGHNESS) TEXTURE =========================================================================================
-		if (assimpMaterial->GetTextureCount(aiTextureType_SHININESS) > 0)
-		{
-			if (assimpMaterial->GetTexture(aiTextureType_SHININESS, 0, &texturePath, nullptr, nullptr, nullptr, nullptr, nullptr) == AI_SUCCESS)
-			{
-				AddTextureToMaterial(model, material, Roughness_Texture, texturePath.data);
-			}
-		}
-
-		//= AMBIENT (used as METALLIC) TEXTURE ========================================================================================
-		if (assimpMaterial->GetTextureCount(aiTextureType_AMBIENT) > 0)
+		for (const auto& texture : cooked.textures)
 		{
-			if (assimpMaterial->GetTexture(aiTextureType_AMBIENT, 0, &texturePath, nullptr, nullptr, nullptr, nullptr, nullptr) == AI_SUCCESS)
-			{
-				AddTextureToMaterial(model, material, Metallic_Texture, texturePath.data);
-			}
+			AddTextureToMaterial(model, material, texture.first, texture.second);
 		}
 
-		//= NORMAL TEXTURE =============================================================================================================
-		if (assimpMaterial->GetTextureCount(aiTextureType_NORMALS) > 0)
-		{
-			if (assimpMaterial->GetTexture(aiTextureType_NORMALS, 0, &texturePath, nullptr, nullptr, nullptr, nullptr, nullptr) == AI_SUCCESS)
-			{
-				AddTextureToMaterial(model, material, Normal_Texture, texturePath.data);
-			}
-		}
-
-		//= OCCLUSION TEXTURE ===========================================================================================================
-		if (assimpMaterial->GetTextureCount(aiTextureType_LIGHTMAP) > 0)
-		{
-			if (assimpMaterial->GetTexture(aiTextureType_LIGHTMAP, 0, &texturePath, nullptr, nullptr, nullptr, nullptr, nullptr) == AI_SUCCESS)
-			{
-				AddTextureToMaterial(model, material, Occlusion_Texture, texturePath.data);
-			}
-		}
-
-		//= EMISSIVE TEXTURE ============================================================================================================
-		if (assimpMaterial->GetTextureCount(aiTextureType_EMISSIVE) > 0)
-		{
-			if (assimpMaterial->GetTexture(aiTextureType_EMISSIVE, 0, &texturePath, nullptr, nullptr, nullptr, nullptr, nullptr) == AI_SUCCESS)
-			{
-				AddTextureToMaterial(model, material, Emission_Texture, texturePath.data);
-			}
-		}
-		//= HEIGHT TEXTURE ============================================================================================================
-		if (assimpMaterial->GetTextureCount(aiTextureType_HEIGHT) > 0)
-		{
-			if (assimpMaterial->GetTexture(aiTextureType_HEIGHT, 0, &texturePath, nullptr, nullptr, nullptr, nullptr, nullptr) == AI_SUCCESS)
-			{
-				AddTextureToMaterial(model, material, Height_Texture, texturePath.data);
-			}
-		}
-
-		//= MASK TEXTURE ===============================================================================================================
-		if (assimpMaterial->GetTextureCount(aiTextureType_OPACITY) > 0)
-		{
-			if (assimpMaterial->GetTexture(aiTextureType_OPACITY, 0, &texturePath, nullptr, nullptr, nullptr, nullptr, nullptr) == AI_SUCCESS)
-			{
-				AddTextureToMaterial(model, material, Mask_Texture, texturePath.data);
-			}
-		}
 		return material;
 	}
 	//============================================================================================
 
 	//= HELPER FUNCTIONS =========================================================================
-	void ModelImporter::AddTextureToMaterial(Model* model, const weak_ptr<Material>& material, TextureType textureType, const string& originalTexturePath)
+	void ModelImporter::AddTextureToMaterial(Model* model, const weak_ptr<Material>& material, TextureType textureType, const string& texturePath)
 	{
 		if (material.expired())
 			return;
 
-		string texturePath = FindTexture(originalTexturePath);
-		if (texturePath == NOT_ASSIGNED)
-		{
-			LOG_WARNING("ModelImporter: Failed to find model requested texture \"" + originalTexturePath + "\".");
-			return;
-		}
-
 		// Copy the source texture a directory which will be relative to the model
 		string relativeFilePath = model->CopyTextureToLocalDirectory(texturePath);
 
@@ -549,81 +245,6 @@ namespace Directus
 		}
 	}
 
-	string ModelImporter::FindTexture(const string& originalTexturePath)
-	{
-		// Models usually return a texture path which is relative to the model's directory.
-		// However, to load anything, we'll need an absolute path, so we construct it here.
-		string modelDir = FileSystem::GetDirectoryFromFilePath(m_modelPath);
-		string fullTexturePath = modelDir + originalTexturePath;
-
-		// 1. Check if the texture path is valid
-		if (FileSystem::FileExists(fullTexturePath))
-			return fullTexturePath;
-
-		// 2. Check the same texture path as previously but 
-		// this time with different file extensions (jpg, png and so on).
-		fullTexturePath = TryPathWithMultipleExtensions(fullTexturePath);
-		if (FileSystem::FileExists(fullTexturePath))
-			return fullTexturePath;
-
-		// At this point we know the provided path is wrong, we will make a few guesses.
-		// The most common mistake is that the artist provided a path which is absolute to his computer.
-
-		// 3. Check if the texture is in the same folder as the model
-		fullTexturePath = modelDir + FileSystem::GetFileNameFromFilePath(fullTexturePath);
-		if (FileSystem::FileExists(fullTexturePath))
-			return fullTexturePath;
-
-		// 4. Check the same texture path as previously but 
-		// this time with different file extensions (jpg, png and so on).
-		fullTexturePath = TryPathWithMultipleExtensions(fullTexturePath);
-		if (FileSystem::FileExists(fullTexturePath))
-			return fullTexturePath;
-
-		// Give up, no valid texture path was found
-		return NOT_ASSIGNED;
-	}
-
-	string ModelImporter::TryPathWithMultipleExtensions(const string& filePath)
-	{
-		// Remove extension
-		string filePathNoExt = FileSystem::GetFilePathWithoutExtension(filePath);
-
-		// Check if the file exists using all engine supported extensions
-		auto supportedFormats = FileSystem::GetSupportedImageFormats();
-		for (unsigned int i = 0; i < supportedFormats.size(); i++)
-		{
-			string newFilePath = filePathNoExt + supportedFormats[i];
-			string newFilePathUpper = filePathNoExt + FileSystem::ConvertToUppercase(supportedFormats[i]);
-
-			if (FileSystem::FileExists(newFilePath))
-			{
-				return newFilePath;
-			}
-
-			if (FileSystem::FileExists(newFilePathUpper))
-			{
-				return newFilePathUpper;
-			}
-		}
-
-		return filePath;
-	}
-
-	void ModelImporter::CalculateNodeCount(aiNode* node, int& count)
-	{
-		if (!node)
-			return;
-
-		count++;
-
-		// Process children
-		for (unsigned int i = 0; i < node->mNumChildren; i++)
-		{
-			CalculateNodeCount(node->mChildren[i], count);
-		}
-	}
-
 	void ModelImporter::ResetStats()
 	{
 		m_status = NOT_ASSIGNED;
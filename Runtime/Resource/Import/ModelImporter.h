@@ -19,6 +19,7 @@ IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
 CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
+
 #pragma once
 
 //= INCLUDES ======================
@@ -26,17 +27,12 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../../Graphics/Model.h"
 //=================================
 
-struct aiNode;
-struct aiScene;
-struct aiMaterial;
-struct aiMesh;
-
 namespace Directus
 {
 	class Material;
-	class GameObject;
 	class Model;
-	class Transform;
+	struct CookedModel;
+	struct CookedMaterial;
 
 	class DLL_API ModelImporter
 	{
@@ -45,7 +41,6 @@ namespace Directus
 		~ModelImporter();
 
 		void LoadAsync(Model* model, const std::string& filePath);
-		void ReadAnimations(Model* model, const aiScene* scene);
 		bool Load(Model* model, const std::string& filePath);
 
 		const std::string& GetStatus() { return m_status; }
@@ -54,17 +49,13 @@ namespace Directus
 
 	private:
 		// PROCESSING
-		void ReadNodeHierarchy(Model* model, const aiScene* assimpScene, aiNode* assimpNode, const std::weak_ptr<GameObject>& parentNode, std::weak_ptr<GameObject>& newNode);
-		void LoadMesh(Model* model, aiMesh* assimpMesh, const aiScene* assimpScene, const std::weak_ptr<GameObject>& parentGameObject);
-		void LoadAiMeshVertices(aiMesh* assimpMesh, std::shared_ptr<Mesh> mesh);
-		void LoadAiMeshIndices(aiMesh* assimpMesh, std::shared_ptr<Mesh> mesh);
-		std::shared_ptr<Material> AiMaterialToMaterial(Model* model, aiMaterial* assimpMaterial);
+		// The source is imported (or loaded from the import cache) by the ModelCooker, then
+		// its hierarchy becomes GameObjects and its materials and textures engine resources.
+		void CreateFromCooked(Model* model, const CookedModel& cooked);
+		std::shared_ptr<Material> CreateMaterial(Model* model, const CookedMaterial& cooked);
 
 		// HELPER FUNCTIONS
 		void AddTextureToMaterial(Model* model, const std::weak_ptr<Material>& material, TextureType textureType, const std::string& texturePath);
-		std::string FindTexture(const std::string& texturePath);
-		std::string TryPathWithMultipleExtensions(const std::string& fullpath);
-		void CalculateNodeCount(aiNode* node, int& count);
 		void ResetStats();
 	
 		Model* m_model;
@@ -78,4 +69,4 @@ namespace Directus
 		
 		Context* m_context;
 	};
-}
\ No newline at end of file
+}
@@ -0,0 +1,116 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+//= INCLUDES =====================
+#include "TextureCooker.h"
+#include <vector>
+#include "ImportCache.h"
+#include "ImageImporter.h"
+#include "../../FileSystem/FileSystem.h"
+#include "../../IO/StreamIO.h"
+#include "../../Logging/Log.h"
+//================================
+
+//= NAMESPACES =====
+using namespace std;
+//==================
+
+namespace Directus
+{
+	string TextureCooker::ComputeKey(ImportCache* importCache, const string& filePath, bool generateMipmaps)
+	{
+		return importCache->ComputeKey(filePath, (TEXTURE_COOK_VERSION << 1) | (int)generateMipmaps);
+	}
+
+	bool TextureCooker::Save(const string& filePath, ImageImporter* imageImp, bool generateMipmaps)
+	{
+		StreamIO stream(filePath, Stream_Write);
+		if (!stream.IsOpen())
+			return false;
+
+		stream.WriteInt(imageImp->GetWidth());
+		stream.WriteInt(imageImp->GetHeight());
+		stream.WriteInt(imageImp->GetChannels());
+		stream.WriteBool(imageImp->IsGrayscale());
+		stream.WriteBool(imageImp->IsTransparent());
+
+		if (generateMipmaps)
+		{
+			stream.WriteInt((int)imageImp->GetRGBAMipChain().size());
+			for (const auto& mip : imageImp->GetRGBAMipChain())
+			{
+				stream.WriteVectorUChar(mip);
+			}
+		}
+		else
+		{
+			unsigned char* rgba = imageImp->GetRGBA();
+			stream.WriteInt(1);
+			stream.WriteVectorUChar(vector<unsigned char>(rgba, rgba + imageImp->GetWidth() * imageImp->GetHeight() * 4));
+		}
+
+		return stream.Close();
+	}
+
+	string TextureCooker::Cook(ImportCache* importCache, const string& filePath, bool generateMipmaps, bool* upToDate)
+	{
+		if (upToDate)
+		{
+			*upToDate = false;
+		}
+
+		string key = ComputeKey(importCache, filePath, generateMipmaps);
+		if (key.empty())
+		{
+			LOG_WARNING("TextureCooker: Can't read \"" + filePath + "\".");
+			return "";
+		}
+
+		string artefact = importCache->Find(filePath, key);
+		if (!artefact.empty())
+		{
+			importCache->Record(filePath, key, artefact);
+			if (upToDate)
+			{
+				*upToDate = true;
+			}
+			return artefact;
+		}
+
+		ImageImporter imageImp;
+		if (!imageImp.Load(filePath, generateMipmaps))
+		{
+			LOG_WARNING("TextureCooker: Failed to load \"" + filePath + "\".");
+			return "";
+		}
+
+		artefact = importCache->GetArtefactFilePath(key, TEXTURE_EXTENSION);
+		if (!Save(artefact, &imageImp, generateMipmaps))
+		{
+			LOG_WARNING("TextureCooker: Failed to save \"" + artefact + "\".");
+			return "";
+		}
+		importCache->Record(filePath, key, artefact);
+
+		return artefact;
+	}
+}
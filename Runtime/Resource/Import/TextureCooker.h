@@ -0,0 +1,51 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+
+#pragma once
+
+//= INCLUDES ==============
+#include <string>
+#include "../../Core/Helper.h"
+//=========================
+
+// Bump when the cooked texture layout changes, so that old artefacts get re-cooked
+#define TEXTURE_COOK_VERSION 1
+
+namespace Directus
+{
+	class ImportCache;
+	class ImageImporter;
+
+	// Cooks source images to the engine's texture format, a mip chain that uploads as it is.
+	// It doesn't need a graphics device, so textures can be cooked offline as well as on load.
+	class DLL_API TextureCooker
+	{
+	public:
+		// Returns the import cache key of a source image, empty if the file can't be read
+		static std::string ComputeKey(ImportCache* importCache, const std::string& filePath, bool generateMipmaps);
+		// Writes a decoded image to a cooked texture file
+		static bool Save(const std::string& filePath, ImageImporter* imageImp, bool generateMipmaps);
+		// Decodes and cooks a source image into the import cache, unless it's up to date already.
+		// Returns the cooked texture's path, empty on failure.
+		static std::string Cook(ImportCache* importCache, const std::string& filePath, bool generateMipmaps, bool* upToDate = nullptr);
+	};
+}
@@ -0,0 +1,75 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//= INCLUDES ===========
+#include "Resource.h"
+#include "ResourceCache.h"
+//======================
+
+//= NAMESPACES =====
+using namespace std;
+//==================
+
+namespace Directus
+{
+	void Resource::SetResourceID(unsigned int ID)
+	{
+		SetKey(m_resourceID, ID);
+	}
+
+	void Resource::SetResourceType(ResourceType type)
+	{
+		SetKey(m_resourceType, type);
+	}
+
+	void Resource::SetResourceName(const string& name)
+	{
+		SetKey(m_resourceName, name);
+	}
+
+	void Resource::SetResourceFilePath(const string& filePath)
+	{
+		SetKey(m_resourceFilePath, filePath);
+	}
+
+	template <class T>
+	void Resource::SetKey(T& key, const T& value)
+	{
+		// Only the thread that loads a resource uses it before it's cached
+		ResourceCache* cache = m_cache;
+		if (!cache)
+		{
+			key = value;
+			return;
+		}
+
+		// Lookups on other threads might be indexing the keys meanwhile.
+		// In-place reloads often set the same keys again, those are skipped.
+		cache->SetKey(this, [&key, &value]()
+		{
+			if (key == value)
+				return false;
+
+			key = value;
+			return true;
+		});
+	}
+}
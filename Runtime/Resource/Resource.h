@@ -22,6 +22,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #pragma once
 
 //= INCLUDES ========================
+#include <atomic>
+#include <vector>
 #include "../Core/Context.h"
 #include "../FileSystem/FileSystem.h"
 #include "../Core/GUIDGenerator.h"
@@ -45,6 +47,8 @@ namespace Directus
 		Font_Resource
 	};
 
+	class ResourceCache;
+
 	class DLL_API Resource
 	{
 	public:
@@ -52,21 +56,23 @@ namespace Directus
 
 		void InitializeResource(ResourceType resourceType)
 		{
-			m_resourceType = resourceType;
-			m_resourceID = GENERATE_GUID;
+			SetResourceType(resourceType);
+			SetResourceID(GENERATE_GUID);
 		}
 
+		// The ID, type, name and file path are the keys the cache indexes the resource by.
+		// Once it's cached, they are changed through the cache, under its exclusive lock.
 		unsigned int GetResourceID() { return m_resourceID; }
-		void SetResourceID(unsigned int ID) { m_resourceID = ID; }
+		void SetResourceID(unsigned int ID);
 
 		ResourceType GetResourceType() { return m_resourceType; }
-		void SetResourceType(ResourceType type) { m_resourceType = type; }
+		void SetResourceType(ResourceType type);
 
 		std::string& GetResourceName() { return m_resourceName; }
-		void SetResourceName(const std::string& name) { m_resourceName = name; }
+		void SetResourceName(const std::string& name);
 
 		std::string& GetResourceFilePath() { return m_resourceFilePath; }
-		void SetResourceFilePath(const std::string& filePath) { m_resourceFilePath = filePath; }
+		void SetResourceFilePath(const std::string& filePath);
 
 		std::string GetResourceFileName() { return FileSystem::GetFileNameNoExtensionFromFilePath(m_resourceFilePath); }
 		std::string GetResourceDirectory() { return FileSystem::GetDirectoryFromFilePath(m_resourceFilePath); }
@@ -75,13 +81,45 @@ namespace Directus
 		virtual bool SaveToFile(const std::string& filePath) = 0;
 		virtual bool LoadFromFile(const std::string& filePath) = 0;
 
+		// Async loading, split in two steps. Decode() runs on a worker thread and must not
+		// touch the GPU or the resource cache. Commit() runs on the main thread once the
+		// dependencies are loaded. Resources that don't split their loading, load in Commit().
+		virtual bool Decode(const std::string& filePath) { return true; }
+		virtual bool Commit(const std::string& filePath) { return LoadFromFile(filePath); }
+
+		// Resources that have to be loaded before this one is committed, known after Decode()
+		const std::vector<std::pair<ResourceType, std::string>>& GetDependencies() { return m_dependencies; }
+
+		// Approximate memory used by the resource in system and in video memory, in bytes
+		virtual size_t GetMemoryUsageCPU() { return 0; }
+		virtual size_t GetMemoryUsageGPU() { return 0; }
+		size_t GetMemoryUsage() { return GetMemoryUsageCPU() + GetMemoryUsageGPU(); }
+		// Frame in which the resource was last looked up through the cache
+		unsigned int GetLastAccessFrame() { return m_lastAccessFrame; }
+
 	private:
 		unsigned int m_resourceID = NOT_ASSIGNED_HASH;
 		std::string m_resourceName = NOT_ASSIGNED;
 		std::string m_resourceFilePath = NOT_ASSIGNED;
 		ResourceType m_resourceType = Unknown_Resource;
 
+		// Key tracking (used by the ResourceCache indices)
+		friend class ResourceCache;
+		template <class T> void SetKey(T& key, const T& value);
+		std::atomic<ResourceCache*> m_cache{ nullptr }; // the cache holding the resource, if any
+
+		// Memory tracking (used by the ResourceCache budgets)
+		std::atomic<unsigned int> m_lastAccessFrame{ 0 };
+		size_t m_cachedMemoryUsage = 0;
+		unsigned int m_cacheReferences = 0; // strong references held by the cache, changed under its lock
+
 	protected:	
 		Context* m_context = nullptr;
+		std::vector<std::pair<ResourceType, std::string>> m_dependencies;
 	};
+
+	// Maps a resource class to its ResourceType, so that it can be looked up without RTTI.
+	// Specialized next to each resource class, classes without one are Unknown_Resource.
+	template <class T>
+	ResourceType ToResourceType() { return Unknown_Resource; }
 }
\ No newline at end of file
@@ -0,0 +1,396 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+//= INCLUDES ==============
+#include <algorithm>
+#include "ResourceCache.h"
+#include "../Logging/Log.h"
+//=========================
+
+//= NAMESPACES =====
+using namespace std;
+//==================
+
+namespace Directus
+{
+	ResourceCache::ResourceCache()
+	{
+		m_indicesStale = false;
+		m_currentFrame = 0;
+	}
+
+	void ResourceCache::Unload()
+	{
+		unique_lock<shared_timed_mutex> lock(m_mutex);
+
+		for (const auto& resource : m_resources)
+		{
+			resource->m_cache = nullptr;
+			resource->m_cacheReferences = 0;
+		}
+
+		m_resources.clear();
+		m_resources.shrink_to_fit();
+		m_byID.clear();
+		m_byName.clear();
+		m_byPath.clear();
+		m_byType.clear();
+		m_indicesStale = false;
+		m_memoryUsage.clear();
+		m_evicted.clear();
+		m_evictedPaths.clear();
+	}
+
+	shared_ptr<Resource> ResourceCache::Add(shared_ptr<Resource> resource)
+	{
+		if (!resource)
+			return resource;
+
+		unique_lock<shared_timed_mutex> lock(m_mutex);
+
+		// Checking and adding under the same lock, else two threads could add the same resource
+		UpdateIndices();
+		auto existing = m_byName.find(resource->GetResourceName());
+		if (existing != m_byName.end())
+		{
+			if (auto cached = existing->second.lock())
+				return cached;
+		}
+
+		// A resource coming back after eviction gets its old ID, so lookups by ID keep working
+		auto evicted = m_evicted.find(FileSystem::NormalizePath(resource->GetResourceFilePath()));
+		if (evicted != m_evicted.end())
+		{
+			resource->SetResourceID(evicted->second.ID);
+			m_evictedPaths.erase(evicted->second.ID);
+			m_evicted.erase(evicted);
+		}
+
+		m_resources.push_back(resource);
+		resource->m_cache = this;
+		resource->m_cacheReferences = 1;
+		resource->m_lastAccessFrame = m_currentFrame.load();
+		resource->m_cachedMemoryUsage = resource->GetMemoryUsage();
+		m_memoryUsage[resource->GetResourceType()] += resource->m_cachedMemoryUsage;
+
+		// Stale indices are rebuilt by the next lookup, with this resource in them
+		if (IndicesValid())
+		{
+			Index(resource);
+		}
+
+		return resource;
+	}
+
+	vector<string> ResourceCache::GetResourceFilePaths()
+	{
+		shared_lock<shared_timed_mutex> lock(m_mutex);
+
+		vector<string> filePaths;
+		for (const auto& resource : m_resources)
+		{
+			filePaths.push_back(resource->GetResourceFilePath());
+		}
+
+		return filePaths;
+	}
+
+	shared_ptr<Resource> ResourceCache::GetByID(const size_t ID)
+	{
+		auto lock = LockIndices();
+
+		auto it = m_byID.find((unsigned int)ID);
+		return it != m_byID.end() ? Access(it->second) : shared_ptr<Resource>();
+	}
+
+	shared_ptr<Resource> ResourceCache::GetByName(const string& name)
+	{
+		auto lock = LockIndices();
+
+		auto it = m_byName.find(name);
+		return it != m_byName.end() ? Access(it->second) : shared_ptr<Resource>();
+	}
+
+	shared_ptr<Resource> ResourceCache::GetByPath(const string& filePath)
+	{
+		string normalizedPath = FileSystem::NormalizePath(filePath);
+		auto lock = LockIndices();
+
+		auto it = m_byPath.find(normalizedPath);
+		return it != m_byPath.end() ? Access(it->second) : shared_ptr<Resource>();
+	}
+
+	ResourceSnapshot ResourceCache::GetByType(ResourceType type)
+	{
+		static const ResourceSnapshot empty = make_shared<const vector<shared_ptr<Resource>>>();
+
+		auto lock = LockIndices();
+
+		auto it = m_byType.find(type);
+		if (it == m_byType.end())
+			return empty;
+
+		return it->second;
+	}
+
+	vector<shared_ptr<Resource>> ResourceCache::GetAll()
+	{
+		shared_lock<shared_timed_mutex> lock(m_mutex);
+		return m_resources;
+	}
+
+	void ResourceCache::SaveResourceMetadata()
+	{
+		// Saving happens outside of the lock, it's slow
+		for (const auto& resource : GetAll())
+		{
+			resource->SaveToFile(RESOURCE_SAVE);
+		}
+	}
+
+	bool ResourceCache::CachedByID(shared_ptr<Resource> resourceIn)
+	{
+		if (!resourceIn)
+			return false;
+
+		return (bool)GetByID(resourceIn->GetResourceID());
+	}
+
+	bool ResourceCache::CachedByName(shared_ptr<Resource> resourceIn)
+	{
+		if (!resourceIn)
+			return false;
+
+		if (resourceIn->GetResourceName() == NOT_ASSIGNED)
+		{
+			LOG_INFO("ResourceCache: CachedByName() might fail as no name has been assigned to the resource");
+		}
+
+		return (bool)GetByName(resourceIn->GetResourceName());
+	}
+
+	void ResourceCache::SetKey(Resource* resource, const function<bool()>& setKey)
+	{
+		if (!resource)
+			return;
+
+		unique_lock<shared_timed_mutex> lock(m_mutex);
+		if (setKey() && resource->m_cache == this)
+		{
+			m_indicesStale = true;
+		}
+	}
+
+	size_t ResourceCache::GetMemoryUsage(ResourceType type)
+	{
+		shared_lock<shared_timed_mutex> lock(m_mutex);
+
+		auto it = m_memoryUsage.find(type);
+		return it != m_memoryUsage.end() ? it->second : 0;
+	}
+
+	void ResourceCache::UpdateMemoryUsage(ResourceType type)
+	{
+		// Measuring happens outside of the lock, resources might walk the scene for it
+		auto resources = GetByType(type);
+		vector<size_t> usage;
+		usage.reserve(resources->size());
+		for (const auto& resource : *resources)
+		{
+			usage.push_back(resource->GetMemoryUsage());
+		}
+
+		unique_lock<shared_timed_mutex> lock(m_mutex);
+		for (size_t i = 0; i < resources->size(); i++)
+		{
+			const auto& resource = (*resources)[i];
+			if (!resource->m_cache)
+				continue;
+
+			m_memoryUsage[type] += usage[i] - resource->m_cachedMemoryUsage;
+			resource->m_cachedMemoryUsage = usage[i];
+		}
+	}
+
+	void ResourceCache::UpdateMemoryUsage(const shared_ptr<Resource>& resource)
+	{
+		if (!resource)
+			return;
+
+		size_t usage = resource->GetMemoryUsage();
+
+		unique_lock<shared_timed_mutex> lock(m_mutex);
+		if (!resource->m_cache)
+			return;
+
+		m_memoryUsage[resource->GetResourceType()] += usage - resource->m_cachedMemoryUsage;
+		resource->m_cachedMemoryUsage = usage;
+	}
+
+	bool ResourceCache::IsShared(const shared_ptr<Resource>& resource)
+	{
+		if (!resource)
+			return false;
+
+		// With the indices up to date, the cache holds exactly m_cacheReferences references
+		auto lock = LockIndices();
+		return !resource->m_cache || resource.use_count() > (long)resource->m_cacheReferences;
+	}
+
+	void ResourceCache::Evict(shared_ptr<Resource> resource)
+	{
+		if (!resource)
+			return;
+
+		unique_lock<shared_timed_mutex> lock(m_mutex);
+
+		if (!resource->m_cache)
+			return;
+
+		auto it = find(m_resources.begin(), m_resources.end(), resource);
+		if (it == m_resources.end())
+			return;
+
+		EvictedResource evicted;
+		evicted.ID = resource->GetResourceID();
+		evicted.type = resource->GetResourceType();
+		evicted.name = resource->GetResourceName();
+		evicted.filePath = resource->GetResourceFilePath();
+		string normalizedPath = FileSystem::NormalizePath(evicted.filePath);
+		m_evictedPaths[evicted.ID] = normalizedPath;
+		m_evicted[normalizedPath] = evicted;
+
+		m_memoryUsage[evicted.type] -= resource->m_cachedMemoryUsage;
+		resource->m_cachedMemoryUsage = 0;
+		resource->m_cache = nullptr;
+		resource->m_cacheReferences = 0;
+		m_resources.erase(it);
+
+		// Rebuild the indices on the next lookup, a resource with the same key might have been hidden
+		m_indicesStale = true;
+	}
+
+	bool ResourceCache::GetEvictedByID(unsigned int ID, EvictedResource& evicted)
+	{
+		shared_lock<shared_timed_mutex> lock(m_mutex);
+
+		auto path = m_evictedPaths.find(ID);
+		if (path == m_evictedPaths.end())
+			return false;
+
+		auto it = m_evicted.find(path->second);
+		if (it == m_evicted.end())
+			return false;
+
+		evicted = it->second;
+		return true;
+	}
+
+	bool ResourceCache::GetEvictedByPath(const string& filePath, EvictedResource& evicted)
+	{
+		string normalizedPath = FileSystem::NormalizePath(filePath);
+		shared_lock<shared_timed_mutex> lock(m_mutex);
+
+		auto it = m_evicted.find(normalizedPath);
+		if (it == m_evicted.end())
+			return false;
+
+		evicted = it->second;
+		return true;
+	}
+
+	shared_ptr<Resource> ResourceCache::Access(const weak_ptr<Resource>& resource)
+	{
+		auto shared = resource.lock();
+		if (shared)
+		{
+			// Lookups run under the shared lock, only write the stamp when it
+			// changes so that readers don't fight over the same cache line.
+			unsigned int frame = m_currentFrame.load(memory_order_relaxed);
+			if (shared->m_lastAccessFrame.load(memory_order_relaxed) != frame)
+			{
+				shared->m_lastAccessFrame.store(frame, memory_order_relaxed);
+			}
+		}
+
+		return shared;
+	}
+
+	shared_lock<shared_timed_mutex> ResourceCache::LockIndices()
+	{
+		shared_lock<shared_timed_mutex> lock(m_mutex);
+
+		// Rebuilding needs the exclusive lock, readers only pay for it once per change
+		while (!IndicesValid())
+		{
+			lock.unlock();
+			{
+				unique_lock<shared_timed_mutex> writeLock(m_mutex);
+				UpdateIndices();
+			}
+			lock.lock();
+		}
+
+		return lock;
+	}
+
+	void ResourceCache::UpdateIndices()
+	{
+		if (!m_indicesStale)
+			return;
+
+		// New buckets, readers might still be iterating the old ones
+		m_byID.clear();
+		m_byName.clear();
+		m_byPath.clear();
+		m_byType.clear();
+
+		for (const auto& resource : m_resources)
+		{
+			resource->m_cacheReferences = 1;
+			Index(resource);
+		}
+
+		m_indicesStale = false;
+	}
+
+	void ResourceCache::Index(const shared_ptr<Resource>& resource)
+	{
+		// emplace() keeps the first resource for a key, which
+		// matches what the old linear searches would return.
+		m_byID.emplace(resource->GetResourceID(), resource);
+		m_byName.emplace(resource->GetResourceName(), resource);
+		m_byPath.emplace(FileSystem::NormalizePath(resource->GetResourceFilePath()), resource);
+
+		// Copy on write, unless nobody besides the cache holds the bucket
+		auto& bucket = m_byType[resource->GetResourceType()];
+		if (!bucket)
+		{
+			bucket = make_shared<vector<shared_ptr<Resource>>>();
+		}
+		else if (bucket.use_count() > 1)
+		{
+			bucket = make_shared<vector<shared_ptr<Resource>>>(*bucket);
+		}
+		bucket->push_back(resource);
+		resource->m_cacheReferences++;
+	}
+}
@@ -21,133 +21,133 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 #pragma once
 
-//= INCLUDES ==============
+//= INCLUDES ============
 #include <vector>
 #include <memory>
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
 #include "Resource.h"
 #include "../Logging/Log.h"
-//========================
+//=======================
 
 namespace Directus
 {
+	// What's left of an evicted resource, enough to reload it
+	struct EvictedResource
+	{
+		unsigned int ID;
+		ResourceType type;
+		std::string name;
+		std::string filePath;
+	};
+
+	// An immutable list of resources, it stays valid while the cache changes
+	typedef std::shared_ptr<const std::vector<std::shared_ptr<Resource>>> ResourceSnapshot;
+
+	// The cache can be used from any thread. Lookups take a shared lock, so readers don't block
+	// each other, while adding and evicting take an exclusive one. The type buckets are copied
+	// on write, which lets the render loop iterate them without holding the lock.
+
 	class DLL_API ResourceCache
 	{
 	public:
-		ResourceCache() {}
+		ResourceCache();
 		~ResourceCache() { Unload(); }
 
 		// Unloads all resources
-		void Unload()
-		{
-			m_resources.clear();
-			m_resources.shrink_to_fit();
-		}
-
-		// Adds a resource
-		void Add(std::shared_ptr<Resource> resource)
-		{
-			if (!resource)
-				return;
+		void Unload();
 
-			m_resources.push_back(resource);
-		}
+		// Adds a resource and returns it. If one with the same name is cached already,
+		// that one is returned instead, so threads that load the same file agree on it.
+		std::shared_ptr<Resource> Add(std::shared_ptr<Resource> resource);
 
 		// Returns the file paths of all the resources
-		std::vector<std::string> GetResourceFilePaths()
-		{
-			std::vector<std::string> filePaths;
-			for (const auto& resource : m_resources)
-			{
-				filePaths.push_back(resource->GetResourceFilePath());
-			}
-
-			return filePaths;
-		}
+		std::vector<std::string> GetResourceFilePaths();
 
 		// Returns a resource by ID
-		std::shared_ptr<Resource> GetByID(const std::size_t ID)
-		{
-			for (const auto& resource : m_resources)
-			{
-				if (resource->GetResourceID() == ID)
-					return resource;
-			}
-
-			return std::shared_ptr<Resource>();
-		}
+		std::shared_ptr<Resource> GetByID(const std::size_t ID);
 
 		// Returns a resource by name
-		std::shared_ptr<Resource> GetByName(const std::string& name)
-		{
-			for (const auto& resource : m_resources)
-			{
-				if (resource->GetResourceName() == name)
-					return resource;
-			}
-
-			return std::shared_ptr<Resource>();
-		}
+		std::shared_ptr<Resource> GetByName(const std::string& name);
 
 		// Returns a resource by file path
-		std::shared_ptr<Resource> GetByPath(const std::string& filePath)
-		{
-			for (const auto& resource : m_resources)
-			{
-				if (resource->GetResourceFilePath() == filePath)
-					return resource;
-			}
+		std::shared_ptr<Resource> GetByPath(const std::string& filePath);
 
-			return std::shared_ptr<Resource>();
-		}
+		// Returns all the resources of a type
+		ResourceSnapshot GetByType(ResourceType type);
 
 		// Makes the resources save their metadata
-		void SaveResourceMetadata()
-		{
-			for (const auto& resource : m_resources)
-			{
-				resource->SaveToFile(RESOURCE_SAVE);
-			}
-		}
+		void SaveResourceMetadata();
 
 		// Returns all the resources
-		const auto& GetAll() { return m_resources; }
+		std::vector<std::shared_ptr<Resource>> GetAll();
+
+		// Checks whether a resource is already in the cache
+		bool CachedByID(std::shared_ptr<Resource> resourceIn);
 
 		// Checks whether a resource is already in the cache
-		bool CachedByID(std::shared_ptr<Resource> resourceIn)
-		{
-			if (!resourceIn)
-				return false;
+		bool CachedByName(std::shared_ptr<Resource> resourceIn);
 
-			for (const auto& resource : m_resources)
-			{
-				if (resource->GetResourceID() == resourceIn->GetResourceID())
-					return true;
-			}
+		// Changes a key of a cached resource under the exclusive lock, the function returns
+		// whether it changed anything. Used by the resource's setters, don't call it directly.
+		void SetKey(Resource* resource, const std::function<bool()>& setKey);
 
-			return false;
-		}
+		//= MEMORY =================================================================================
+		// Sets the frame that lookups stamp resources with
+		void SetCurrentFrame(unsigned int frame) { m_currentFrame = frame; }
 
-		// Checks whether a resource is already in the cache
-		bool CachedByName(std::shared_ptr<Resource> resourceIn)
-		{
-			if (!resourceIn)
-				return false;
+		// Returns the memory used by all the cached resources of a type, as of the last measurement
+		size_t GetMemoryUsage(ResourceType type);
+
+		// Measures the memory used by cached resources again, it changes after they are added
+		// as they get uploaded, build acceleration structures or reload in place.
+		void UpdateMemoryUsage(ResourceType type);
+		void UpdateMemoryUsage(const std::shared_ptr<Resource>& resource);
 
-			if (resourceIn->GetResourceName() == NOT_ASSIGNED)
-			{
-				LOG_INFO("ResourceCache: CachedByName() might fail as no name has been assigned to the resource");
-			}
+		// Returns true if anything besides the cache holds a strong reference to the resource, or if
+		// it isn't cached. Old type buckets that are still being iterated count as references too.
+		bool IsShared(const std::shared_ptr<Resource>& resource);
 
-			for (const auto& resource : m_resources)
-			{
-				if (resource->GetResourceName() == resourceIn->GetResourceName())
-					return true;
-			}
+		// Removes a resource from the cache, remembering where it can be reloaded from
+		void Evict(std::shared_ptr<Resource> resource);
 
-			return false;
-		}
+		// Copies what's left of an evicted resource, returns false if there is no such resource
+		bool GetEvictedByID(unsigned int ID, EvictedResource& evicted);
+		bool GetEvictedByPath(const std::string& filePath, EvictedResource& evicted);
+		//==========================================================================================
 
 	private:
+		// Returns a shared lock on the cache, with the indices up to date
+		std::shared_lock<std::shared_timed_mutex> LockIndices();
+		// Returns true if no cached resource changed a key since the indices were built
+		bool IndicesValid() { return !m_indicesStale; }
+		// Rebuilds the indices if they aren't valid, the exclusive lock must be held
+		void UpdateIndices();
+		// Adds a single resource to the indices
+		void Index(const std::shared_ptr<Resource>& resource);
+		// Stamps and returns a looked up resource
+		std::shared_ptr<Resource> Access(const std::weak_ptr<Resource>& resource);
+
+		// The resources and their type buckets are the only strong references the cache holds,
+		// each resource counts how many of them point to it in m_cacheReferences.
 		std::vector<std::shared_ptr<Resource>> m_resources;
+		std::shared_timed_mutex m_mutex;
+
+		// Indices
+		std::unordered_map<unsigned int, std::weak_ptr<Resource>> m_byID;
+		std::unordered_map<std::string, std::weak_ptr<Resource>> m_byName;
+		std::unordered_map<std::string, std::weak_ptr<Resource>> m_byPath;
+		std::map<ResourceType, std::shared_ptr<std::vector<std::shared_ptr<Resource>>>> m_byType;
+		bool m_indicesStale;
+
+		// Memory
+		std::map<ResourceType, size_t> m_memoryUsage;
+		std::unordered_map<std::string, EvictedResource> m_evicted;
+		std::unordered_map<unsigned int, std::string> m_evictedPaths;
+		std::atomic<unsigned int> m_currentFrame;
 	};
-}
\ No newline at end of file
+}
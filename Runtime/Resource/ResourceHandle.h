@@ -0,0 +1,87 @@
+/*
+Copyright(c) 2016-2017 Panos Karabelas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is furnished
+to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#pragma once
+
+//= INCLUDES ======
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "Resource.h"
+//=================
+
+namespace Directus
+{
+	enum LoadState
+	{
+		Load_Pending,
+		Load_Ready,
+		Load_Failed
+	};
+
+	// An asynchronous load, shared between the ResourceManager and the handles to it
+	struct AsyncLoad
+	{
+		AsyncLoad(const std::string& filePath, std::shared_ptr<Resource> resource)
+		{
+			this->filePath = filePath;
+			this->resource = resource;
+		}
+
+		std::string filePath;
+		// The resource being loaded, or the cached one once the load is ready
+		std::shared_ptr<Resource> resource;
+		std::vector<std::shared_ptr<AsyncLoad>> dependencies;
+		std::atomic<LoadState> state{ Load_Pending };
+	};
+
+	// Returned by ResourceManager::LoadAsync(), the resource is valid once IsReady() is true
+	template <class T>
+	class ResourceHandle
+	{
+	public:
+		ResourceHandle() {}
+		ResourceHandle(std::shared_ptr<AsyncLoad> load) { m_load = load; }
+
+		LoadState GetState() const { return m_load ? m_load->state.load() : Load_Failed; }
+		bool IsPending() const { return GetState() == Load_Pending; }
+		bool IsReady() const { return GetState() == Load_Ready; }
+		bool HasFailed() const { return GetState() == Load_Failed; }
+
+		// Returns the resource, empty until the load is ready
+		std::weak_ptr<T> Get() const
+		{
+			if (!IsReady())
+				return std::weak_ptr<T>();
+
+			return std::static_pointer_cast<T>(m_load->resource);
+		}
+
+		const std::string& GetFilePath() const
+		{
+			static const std::string empty;
+			return m_load ? m_load->filePath : empty;
+		}
+
+	private:
+		std::shared_ptr<AsyncLoad> m_load;
+	};
+}
@@ -20,9 +20,21 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
 //= INCLUDES ==========================
+#include <algorithm>
+#include <chrono>
 #include "ResourceManager.h"
 #include "../Core/GameObject.h"
 #include "../EventSystem/EventSystem.h"
+#include "../Threading/Threading.h"
+#include "../Graphics/Texture.h"
+#include "../Graphics/Material.h"
+#include "../Graphics/Model.h"
+#include "../Graphics/Mesh.h"
+#include "../Core/Scene.h"
+#include "../Components/MeshRenderer.h"
+#include "../Components/MeshFilter.h"
+#include "../Components/Script.h"
+#include "../Graphics/DeferredShaders/ShaderVariation.h"
 //=====================================
 
 //= NAMESPACES ================
@@ -30,12 +42,18 @@ using namespace std;
 using namespace Directus::Math;
 //=============================
 
+// Frames between two checks of the memory budgets
+#define MEMORY_BUDGET_INTERVAL 30
+
 namespace Directus
 {
 	ResourceManager::ResourceManager(Context* context) : Subsystem(context)
 	{
 		m_resourceCache = nullptr;
+		m_frame = 0;
+		m_fileWatcher = make_unique<FileWatcher>();
 		SUBSCRIBE_TO_EVENT(EVENT_CLEAR_SUBSYSTEMS, EVENT_HANDLER(Clear));
+		SUBSCRIBE_TO_EVENT(EVENT_UPDATE, EVENT_HANDLER(Update));
 	}
 
 	bool ResourceManager::Initialize()
@@ -48,6 +66,7 @@ namespace Directus
 		m_modelImporter = make_shared<ModelImporter>(m_context);
 		m_fontImporter = make_shared<FontImporter>(m_context);
 		m_fontImporter->Initialize();
+		m_importCache = make_shared<ImportCache>();
 		
 		// Add engine standard resource directories
 		AddStandardResourceDirectory(Texture_Resource, "Standard Assets//Textures//");
@@ -58,9 +77,25 @@ namespace Directus
 		AddStandardResourceDirectory(Model_Resource, "Standard Assets//Models//");
 		AddStandardResourceDirectory(Material_Resource, "Standard Assets//Materials//");
 
+		// Default memory budgets
+		SetMemoryBudget(Texture_Resource, 1024 * 1024 * 1024);
+		SetMemoryBudget(Model_Resource, 512 * 1024 * 1024);
+
+		// Mount the archives that ship next to the executable
+		for (const auto& filePath : FileSystem::GetFilesInDirectory("."))
+		{
+			if (FileSystem::GetExtensionFromFilePath(filePath) == ARCHIVE_EXTENSION)
+			{
+				MountArchive(filePath);
+			}
+		}
+
 		// Add project directory
 		SetProjectDirectory("Project//");
 
+		// Hot reload stays off, shipped games have no use for it and the editor turns it on
+		SetHotReload(false);
+
 		return true;
 	}
 
@@ -88,5 +123,446 @@ namespace Directus
 		}
 
 		m_projectDirectory = directory;
+
+		// Every project keeps its own import cache
+		if (m_importCache)
+		{
+			m_importCache->Load(m_projectDirectory + "Cache//");
+		}
+
+		// Watch the new project directory instead
+		if (GetHotReload())
+		{
+			SetHotReload(true);
+		}
+	}
+
+	bool ResourceManager::SetMemoryBudget(ResourceType type, size_t bytes)
+	{
+		if (bytes != 0 && !IsReloadable(type))
+		{
+			LOG_WARNING("ResourceManager: Resources of this type can't be reloaded once evicted, ignoring their memory budget.");
+			return false;
+		}
+
+		m_memoryBudgets[type] = bytes;
+		return true;
+	}
+
+	size_t ResourceManager::GetMemoryBudget(ResourceType type)
+	{
+		auto it = m_memoryBudgets.find(type);
+		return it != m_memoryBudgets.end() ? it->second : 0;
+	}
+
+	shared_ptr<Resource> ResourceManager::CreateResource(ResourceType type)
+	{
+		// Keep in sync with IsReloadable(), shaders are only created here
+		// because materials load their variation asynchronously.
+		if (type == Texture_Resource)	return make_shared<Texture>(m_context);
+		if (type == Material_Resource)	return make_shared<Material>(m_context);
+		if (type == Model_Resource)		return make_shared<Model>(m_context);
+		if (type == Shader_Resource)	return make_shared<ShaderVariation>(m_context);
+
+		return shared_ptr<Resource>();
+	}
+
+	//= HOT RELOAD =============================================================================
+	void ResourceManager::SetHotReload(bool enabled)
+	{
+		if (!enabled)
+		{
+			m_fileWatcher->Stop();
+			return;
+		}
+
+		m_fileWatcher->Start({ m_projectDirectory, "Standard Assets//" });
+	}
+
+	void ResourceManager::HotReload()
+	{
+		// Changes wait until the scene is done loading
+		if (!GetHotReload() || m_context->GetSubsystem<Scene>()->IsLoading())
+			return;
+
+		for (const auto& filePath : m_fileWatcher->GetChangedFiles())
+		{
+			// Shaders, recompile every variation of the file
+			if (FileSystem::IsSupportedShaderFile(filePath))
+			{
+				auto shaders = m_resourceCache->GetByType(Shader_Resource);
+				for (const auto& resource : *shaders)
+				{
+					auto shader = static_pointer_cast<ShaderVariation>(resource);
+					if (FileSystem::NormalizePath(shader->GetShaderFilePath()) == filePath)
+					{
+						shader->Recompile();
+						LOG_INFO("ResourceManager: Recompiled \"" + shader->GetResourceName() + "\"");
+					}
+				}
+				continue;
+			}
+
+			// Scripts, instantiate them again in every script component that runs them
+			if (FileSystem::IsEngineScriptFile(filePath))
+			{
+				for (const auto& gameObject : m_context->GetSubsystem<Scene>()->GetAllGameObjects())
+				{
+					for (const auto& script : gameObject->GetComponents<Script>())
+					{
+						string scriptPath = script->GetScriptPath();
+						if (FileSystem::NormalizePath(scriptPath) == filePath)
+						{
+							script->AddScript(scriptPath);
+							LOG_INFO("ResourceManager: Reloaded \"" + scriptPath + "\"");
+						}
+					}
+				}
+				continue;
+			}
+
+			// Textures and materials, reload in place so that references to them stay valid
+			auto resource = m_resourceCache->GetByPath(filePath);
+			if (!resource)
+				continue;
+
+			ResourceType type = resource->GetResourceType();
+			if (type != Texture_Resource && type != Material_Resource)
+				continue;
+
+			if (!resource->LoadFromFile(resource->GetResourceFilePath()))
+			{
+				LOG_WARNING("ResourceManager: Failed to reload \"" + filePath + "\"");
+				continue;
+			}
+			LOG_INFO("ResourceManager: Reloaded \"" + filePath + "\"");
+			m_resourceCache->UpdateMemoryUsage(resource);
+
+			if (type != Texture_Resource)
+				continue;
+
+			// Materials that use the texture pick it up again, in case they were missing it
+			auto materials = m_resourceCache->GetByType(Material_Resource);
+			for (const auto& materialResource : *materials)
+			{
+				auto material = static_pointer_cast<Material>(materialResource);
+				for (const auto& texturePath : material->GetTexturePaths())
+				{
+					if (FileSystem::NormalizePath(texturePath) == filePath)
+					{
+						material->AcquireTextures();
+						material->AcquireShader();
+						break;
+					}
+				}
+			}
+		}
+	}
+	//==========================================================================================
+
+	//= MEMORY BUDGETS =========================================================================
+	void ResourceManager::EnforceMemoryBudgets()
+	{
+		// The scene is still being put together, what's referenced isn't known yet
+		if (m_context->GetSubsystem<Scene>()->IsLoading())
+			return;
+
+		unordered_set<Resource*> referenced;
+		bool referencedCollected = false;
+
+		// Measuring can walk the scene, so usage is refreshed every few frames rather than every frame
+		if (m_frame % MEMORY_BUDGET_INTERVAL != 0)
+			return;
+
+		for (const auto& budget : m_memoryBudgets)
+		{
+			ResourceType type = budget.first;
+			if (budget.second == 0)
+				continue;
+
+			m_resourceCache->UpdateMemoryUsage(type);
+			if (m_resourceCache->GetMemoryUsage(type) <= budget.second)
+				continue;
+
+			if (!referencedCollected)
+			{
+				GetReferencedResources(referenced);
+				referencedCollected = true;
+			}
+
+			// Only resources that nothing uses and that can be reloaded are candidates
+			vector<shared_ptr<Resource>> candidates;
+			auto resources = m_resourceCache->GetByType(type);
+			for (const auto& resource : *resources)
+			{
+				if (m_resourceCache->IsShared(resource) || referenced.count(resource.get()))
+					continue;
+
+				if (!FileSystem::FileExists(resource->GetResourceFilePath()))
+					continue;
+
+				candidates.push_back(resource);
+			}
+
+			// Least recently used first
+			sort(candidates.begin(), candidates.end(), [](const shared_ptr<Resource>& a, const shared_ptr<Resource>& b)
+			{
+				return a->GetLastAccessFrame() < b->GetLastAccessFrame();
+			});
+
+			for (const auto& resource : candidates)
+			{
+				if (m_resourceCache->GetMemoryUsage(type) <= budget.second)
+					break;
+
+				m_resourceCache->Evict(resource);
+			}
+		}
+	}
+
+	void ResourceManager::GetReferencedResources(unordered_set<Resource*>& referenced)
+	{
+		// Whatever the GameObjects in the scene use
+		for (const auto& gameObject : m_context->GetSubsystem<Scene>()->GetAllGameObjects())
+		{
+			if (auto meshRenderer = gameObject->GetComponent<MeshRenderer>())
+			{
+				referenced.insert(meshRenderer->GetMaterial().lock().get());
+			}
+
+			if (auto meshFilter = gameObject->GetComponent<MeshFilter>())
+			{
+				auto mesh = meshFilter->GetMesh().lock();
+				if (mesh)
+				{
+					referenced.insert(m_resourceCache->GetByID(mesh->GetModelID()).get());
+				}
+			}
+		}
+
+		// Materials reference their textures even when they aren't used themselves, as
+		// the textures would be missing once a material that's still cached gets used again.
+		auto materials = m_resourceCache->GetByType(Material_Resource);
+		for (const auto& resource : *materials)
+		{
+			auto material = static_pointer_cast<Material>(resource);
+			for (const auto& texturePath : material->GetTexturePaths())
+			{
+				referenced.insert(m_resourceCache->GetByPath(texturePath).get());
+			}
+		}
+	}
+
+	shared_ptr<Resource> ResourceManager::Reload(const EvictedResource& evicted)
+	{
+		auto resource = CreateResource(evicted.type);
+		if (!resource || !resource->LoadFromFile(evicted.filePath))
+		{
+			LOG_WARNING("ResourceManager: Failed to reload evicted resource \"" + evicted.filePath + "\"");
+			return shared_ptr<Resource>();
+		}
+
+		// Adding it back restores its ID, if another thread reloaded it first, its copy is returned
+		return m_resourceCache->Add(resource);
+	}
+	//==========================================================================================
+
+	//= ASYNC LOADING ==========================================================================
+	void ResourceManager::Update()
+	{
+		if (!m_resourceCache)
+			return;
+
+		m_frame++;
+		m_resourceCache->SetCurrentFrame(m_frame);
+
+		CommitAsyncLoads();
+		HotReload();
+		EnforceMemoryBudgets();
+
+		// Persist new imports once loading settles, so a crash doesn't lose them
+		if (!IsLoading())
+		{
+			m_importCache->Save();
+		}
+	}
+
+	void ResourceManager::CommitAsyncLoads()
+	{
+		// The main thread and a thread that waits for the loads can both be committing
+		lock_guard<mutex> commitLock(m_commitMutex);
+
+		// Resolve the dependencies of freshly decoded resources
+		vector<shared_ptr<AsyncLoad>> decoded;
+		{
+			lock_guard<mutex> lock(m_asyncMutex);
+			decoded.swap(m_asyncDecoded);
+		}
+
+		for (const auto& load : decoded)
+		{
+			for (const auto& dependency : load->resource->GetDependencies())
+			{
+				auto dependencyLoad = LoadDependencyAsync(dependency.first, dependency.second);
+				if (dependencyLoad)
+				{
+					load->dependencies.push_back(dependencyLoad);
+				}
+			}
+			m_asyncCommits.push_back(load);
+		}
+
+		// Commit every resource whose dependencies are done, repeating
+		// until nothing changes so that whole chains finish in one frame.
+		bool committed = true;
+		while (committed)
+		{
+			committed = false;
+			for (auto it = m_asyncCommits.begin(); it != m_asyncCommits.end();)
+			{
+				auto load = *it;
+				bool waiting = false;
+				for (const auto& dependency : load->dependencies)
+				{
+					waiting = waiting || dependency->state == Load_Pending;
+				}
+
+				if (waiting)
+				{
+					++it;
+					continue;
+				}
+
+				it = m_asyncCommits.erase(it);
+				CommitAsyncLoad(load);
+				committed = true;
+			}
+		}
+	}
+
+	bool ResourceManager::IsLoading()
+	{
+		lock_guard<mutex> lock(m_asyncMutex);
+		return !m_asyncLoads.empty();
+	}
+
+	void ResourceManager::WaitForAsyncLoads()
+	{
+		// The waiting thread commits by itself, as the main thread might not be updating,
+		// e.g. the editor stops the engine while it loads a scene on another thread.
+		while (IsLoading())
+		{
+			CommitAsyncLoads();
+
+			unique_lock<mutex> lock(m_asyncMutex);
+			if (m_asyncDecoded.empty() && !m_asyncLoads.empty())
+			{
+				m_asyncCondition.wait_for(lock, chrono::milliseconds(1));
+			}
+		}
+	}
+
+	shared_ptr<AsyncLoad> ResourceManager::GetAsyncLoad(const string& filePath)
+	{
+		lock_guard<mutex> lock(m_asyncMutex);
+
+		auto it = m_asyncLoads.find(filePath);
+		return it != m_asyncLoads.end() ? it->second : shared_ptr<AsyncLoad>();
+	}
+
+	shared_ptr<AsyncLoad> ResourceManager::QueueAsyncLoad(const string& filePath, shared_ptr<Resource> resource)
+	{
+		if (!resource)
+			return shared_ptr<AsyncLoad>();
+
+		shared_ptr<AsyncLoad> load;
+		{
+			lock_guard<mutex> lock(m_asyncMutex);
+
+			// Another thread might have started loading the same file in the meantime
+			auto it = m_asyncLoads.find(filePath);
+			if (it != m_asyncLoads.end())
+				return it->second;
+
+			load = make_shared<AsyncLoad>(filePath, resource);
+			m_asyncLoads[filePath] = load;
+		}
+
+		m_context->GetSubsystem<Threading>()->AddTask([this, load]()
+		{
+			if (!load->resource->Decode(load->filePath))
+			{
+				LOG_WARNING("ResourceManager: Resource \"" + load->filePath + "\" failed to load");
+				FinishAsyncLoad(load, false);
+				return;
+			}
+
+			lock_guard<mutex> lock(m_asyncMutex);
+			m_asyncDecoded.push_back(load);
+			m_asyncCondition.notify_all();
+		});
+
+		return load;
+	}
+
+	shared_ptr<AsyncLoad> ResourceManager::LoadDependencyAsync(ResourceType type, const string& filePathIn)
+	{
+		string filePath = FileSystem::GetRelativeFilePath(filePathIn);
+
+		// Check if the resource is already loaded
+		auto cached = m_resourceCache->GetByPath(filePath);
+		if (cached)
+		{
+			auto load = make_shared<AsyncLoad>(filePath, cached);
+			load->state = Load_Ready;
+			return load;
+		}
+
+		// Check if it's already being loaded
+		auto load = GetAsyncLoad(filePath);
+		if (load)
+			return load;
+
+		auto resource = CreateResource(type);
+		if (!resource)
+		{
+			LOG_WARNING("ResourceManager: Can't load dependency \"" + filePath + "\" asynchronously");
+			return shared_ptr<AsyncLoad>();
+		}
+
+		return QueueAsyncLoad(filePath, resource);
+	}
+
+	void ResourceManager::CommitAsyncLoad(const shared_ptr<AsyncLoad>& load)
+	{
+		if (!load->resource->Commit(load->filePath))
+		{
+			LOG_WARNING("ResourceManager: Resource \"" + load->filePath + "\" failed to load");
+			FinishAsyncLoad(load, false);
+			return;
+		}
+
+		// If the resource is already loaded, use the existing one
+		auto cached = m_resourceCache->Add(load->resource);
+		if (cached->GetResourceType() != load->resource->GetResourceType())
+		{
+			FinishAsyncLoad(load, false);
+			return;
+		}
+		load->resource = cached;
+
+		FinishAsyncLoad(load, true);
+	}
+
+	void ResourceManager::FinishAsyncLoad(const shared_ptr<AsyncLoad>& load, bool success)
+	{
+		lock_guard<mutex> lock(m_asyncMutex);
+
+		// The dependencies are of no use anymore
+		load->dependencies.clear();
+		load->state = success ? Load_Ready : Load_Failed;
+		m_asyncLoads.erase(load->filePath);
+		m_asyncCondition.notify_all();
 	}
-}
+	//==========================================================================================
+}
\ No newline at end of file
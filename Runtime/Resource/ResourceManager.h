@@ -24,12 +24,20 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 //= INCLUDES ====================
 #include <memory>
 #include <map>
+#include <mutex>
+#include <condition_variable>
+#include <unordered_map>
+#include <unordered_set>
 #include "ResourceCache.h"
+#include "ResourceHandle.h"
+#include "../FileSystem/FileWatcher.h"
+#include "../FileSystem/AssetArchive.h"
 #include "../Core/SubSystem.h"
 #include "../Core/GameObject.h"
 #include "Import/ModelImporter.h"
 #include "Import/ImageImporter.h"
 #include "Import/FontImporter.h"
+#include "Import/ImportCache.h"
 //===============================
 
 namespace Directus
@@ -70,6 +78,40 @@ namespace Directus
 			return Add(typed);
 		}
 
+		// Loads a resource on the worker threads and returns a handle to it. Its dependencies
+		// are loaded as well and the GPU work happens on the main thread, during Update().
+		template <class T>
+		ResourceHandle<T> LoadAsync(const std::string& filePath)
+		{
+			// Try to make the path relative to the engine (in case it isn't)
+			std::string relativeFilePath = FileSystem::GetRelativeFilePath(filePath);
+
+			// Check if the resource is already loaded (evicted resources are reloaded asynchronously)
+			auto cached = ToDerivedWeak<T>(m_resourceCache->GetByPath(relativeFilePath));
+			if (!cached.expired())
+			{
+				auto load = std::make_shared<AsyncLoad>(relativeFilePath, ToBaseShared(cached.lock()));
+				load->state = Load_Ready;
+				return ResourceHandle<T>(load);
+			}
+
+			// Check if it's already being loaded, else start loading it
+			auto load = GetAsyncLoad(relativeFilePath);
+			if (!load)
+			{
+				load = QueueAsyncLoad(relativeFilePath, ToBaseShared(std::make_shared<T>(m_context)));
+			}
+
+			return ResourceHandle<T>(load);
+		}
+
+		// Commits decoded resources, called by the main thread every frame
+		void Update();
+		// Returns true while asynchronous loads are in flight
+		bool IsLoading();
+		// Blocks until all asynchronous loads are done, committing them on the calling thread
+		void WaitForAsyncLoads();
+
 		// Adds a resource into the resource cache
 		template <class T>
 		std::weak_ptr<T> Add(std::shared_ptr<T> resource)
@@ -77,29 +119,36 @@ namespace Directus
 			if (!resource)
 				return std::weak_ptr<T>();
 
-			std::shared_ptr<Resource> base = ToBaseShared(resource);
-
-			// If the resource is already loaded, return the existing one
-			if (m_resourceCache->CachedByName(base))
-				return ToDerivedWeak<T>(m_resourceCache->GetByName(base->GetResourceName()));
-
-			// Else, add the resource and return it
-			m_resourceCache->Add(base);
-			return resource;
+			// If the resource is already loaded, the existing one is returned
+			return ToDerivedWeak<T>(m_resourceCache->Add(ToBaseShared(resource)));
 		}
 
 		// Returns cached resource by ID
 		template <class T>
 		std::weak_ptr<T> GetResourceByID(const std::size_t ID)
 		{
-			return ToDerivedWeak<T>(m_resourceCache->GetByID(ID));
+			auto resource = m_resourceCache->GetByID(ID);
+			EvictedResource evicted;
+			if (!resource && m_resourceCache->GetEvictedByID((unsigned int)ID, evicted))
+			{
+				resource = Reload(evicted);
+			}
+
+			return ToDerivedWeak<T>(resource);
 		}
 
 		// Returns cached resource by Path
 		template <class T>
 		std::weak_ptr<T> GetResourceByPath(const std::string& filePath)
 		{
-			return ToDerivedWeak<T>(m_resourceCache->GetByPath(filePath));
+			auto resource = m_resourceCache->GetByPath(filePath);
+			EvictedResource evicted;
+			if (!resource && m_resourceCache->GetEvictedByPath(filePath, evicted))
+			{
+				resource = Reload(evicted);
+			}
+
+			return ToDerivedWeak<T>(resource);
 		}
 
 		// Returns cached resource by Type
@@ -107,6 +156,20 @@ namespace Directus
 		std::vector<std::weak_ptr<T>> GetResourcesByType()
 		{
 			std::vector<std::weak_ptr<T>> typedVec;
+
+			// Known types come straight out of their bucket
+			ResourceType type = ToResourceType<T>();
+			if (type != Unknown_Resource)
+			{
+				auto resources = m_resourceCache->GetByType(type);
+				typedVec.reserve(resources->size());
+				for (const auto& resource : *resources)
+				{
+					typedVec.push_back(std::static_pointer_cast<T>(resource));
+				}
+				return typedVec;
+			}
+
 			for (const auto& resource : m_resourceCache->GetAll())
 			{
 				std::weak_ptr<T> typed = ToDerivedWeak<T>(resource);
@@ -124,6 +187,10 @@ namespace Directus
 		template <class T>
 		int GetResourceCountByType()
 		{
+			ResourceType type = ToResourceType<T>();
+			if (type != Unknown_Resource)
+				return (int)m_resourceCache->GetByType(type)->size();
+
 			int count = 0;
 			for (const auto& resource : m_resourceCache->GetAll())
 			{
@@ -135,7 +202,25 @@ namespace Directus
 
 		void SaveResourceMetadata() { m_resourceCache->SaveResourceMetadata(); }
 
+		// Memory budgets, when the resources of a type go over theirs, the least recently used
+		// ones that nothing references get evicted. They reload on the next lookup. 0 means no budget.
+		// Only types that CreateResource() can reload take a budget, false is returned for the rest.
+		bool SetMemoryBudget(ResourceType type, size_t bytes);
+		size_t GetMemoryBudget(ResourceType type);
+		size_t GetMemoryUsage(ResourceType type) { return m_resourceCache->GetMemoryUsage(type); }
+
+		// Hot reload, watches the project and standard asset directories. Changed textures and
+		// materials reload in place, shaders recompile and scripts get instantiated again.
+		// It's off by default, tools like the editor turn it on.
+		void SetHotReload(bool enabled);
+		bool GetHotReload() { return m_fileWatcher->IsRunning(); }
+
+		// Archives, files in a mounted archive load from it instead of the disk
+		bool MountArchive(const std::string& filePath) { return AssetArchive::Mount(filePath); }
+		void UnmountArchive(const std::string& filePath) { AssetArchive::Unmount(filePath); }
+
 		std::vector<std::string> GetResourceFilePaths() { return m_resourceCache->GetResourceFilePaths(); }
+		std::vector<std::shared_ptr<Resource>> GetAllResources() { return m_resourceCache->GetAll(); }
 
 		void AddStandardResourceDirectory(ResourceType type, const std::string& directory);
 		std::string GetStandardResourceDirectory(ResourceType type);
@@ -147,6 +232,9 @@ namespace Directus
 		std::weak_ptr<ImageImporter> GetImageImporter() { return m_imageImporter; }
 		std::weak_ptr<FontImporter> GetFontImporter() { return m_fontImporter; }
 
+		// Imports of unchanged source assets, lives in the project's cache directory
+		std::weak_ptr<ImportCache> GetImportCache() { return m_importCache; }
+
 	private:
 		std::unique_ptr<ResourceCache> m_resourceCache;
 		std::map<ResourceType, std::string> m_standardResourceDirectories;
@@ -156,6 +244,36 @@ namespace Directus
 		std::shared_ptr<ModelImporter> m_modelImporter;
 		std::shared_ptr<ImageImporter> m_imageImporter;
 		std::shared_ptr<FontImporter> m_fontImporter;
+		std::shared_ptr<ImportCache> m_importCache;
+
+		// Hot reload
+		void HotReload();
+		std::unique_ptr<FileWatcher> m_fileWatcher;
+
+		// Memory budgets
+		void EnforceMemoryBudgets();
+		void GetReferencedResources(std::unordered_set<Resource*>& referenced);
+		std::shared_ptr<Resource> Reload(const EvictedResource& evicted);
+		std::map<ResourceType, size_t> m_memoryBudgets;
+		unsigned int m_frame;
+
+		// Creates an empty resource of a type, for the types that can load from a file
+		std::shared_ptr<Resource> CreateResource(ResourceType type);
+		static bool IsReloadable(ResourceType type) { return type == Texture_Resource || type == Material_Resource || type == Model_Resource; }
+
+		// Async loading
+		std::shared_ptr<AsyncLoad> GetAsyncLoad(const std::string& filePath);
+		std::shared_ptr<AsyncLoad> QueueAsyncLoad(const std::string& filePath, std::shared_ptr<Resource> resource);
+		std::shared_ptr<AsyncLoad> LoadDependencyAsync(ResourceType type, const std::string& filePath);
+		void CommitAsyncLoads();
+		void CommitAsyncLoad(const std::shared_ptr<AsyncLoad>& load);
+		void FinishAsyncLoad(const std::shared_ptr<AsyncLoad>& load, bool success);
+		std::unordered_map<std::string, std::shared_ptr<AsyncLoad>> m_asyncLoads;
+		std::vector<std::shared_ptr<AsyncLoad>> m_asyncDecoded;
+		std::vector<std::shared_ptr<AsyncLoad>> m_asyncCommits;
+		std::mutex m_asyncMutex;
+		std::condition_variable m_asyncCondition;
+		std::mutex m_commitMutex;
 
 		// Derived -> Base (as a shared pointer)
 		template <class Type>
@@ -170,6 +288,14 @@ namespace Directus
 		template <class Type>
 		static std::weak_ptr<Type> ToDerivedWeak(std::shared_ptr<Resource> base)
 		{
+			if (!base)
+				return std::weak_ptr<Type>();
+
+			// The resource type tells us whether the cast is valid, no need for RTTI
+			ResourceType type = ToResourceType<Type>();
+			if (type != Unknown_Resource)
+				return base->GetResourceType() == type ? std::static_pointer_cast<Type>(base) : std::shared_ptr<Type>();
+
 			std::shared_ptr<Type> derivedShared = dynamic_pointer_cast<Type>(base);
 			std::weak_ptr<Type> derivedWeak = std::weak_ptr<Type>(derivedShared);
 
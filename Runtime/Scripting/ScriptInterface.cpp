@@ -32,6 +32,8 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include "../Math/MathHelper.h"
 #include "../Core/Timer.h"
 #include "../Components/MeshRenderer.h"
+#include "../Core/Scene.h"
+#include "../Profiling/PerformanceProfiler.h"
 //==================================
 
 //= NAMESPACES ================
@@ -51,6 +53,7 @@ namespace Directus
 		RegisterSettings();
 		RegisterInput();
 		RegisterTime();
+		RegisterScene();
 		RegisterMathHelper();
 		RegisterVector2();
 		RegisterVector3();
@@ -115,6 +118,7 @@ namespace Directus
 		m_scriptEngine->RegisterObjectType("Settings", 0, asOBJ_REF | asOBJ_NOCOUNT);
 		m_scriptEngine->RegisterObjectType("Input", 0, asOBJ_REF | asOBJ_NOCOUNT);
 		m_scriptEngine->RegisterObjectType("Time", 0, asOBJ_REF | asOBJ_NOCOUNT);
+		m_scriptEngine->RegisterObjectType("Scene", 0, asOBJ_REF | asOBJ_NOCOUNT);
 		m_scriptEngine->RegisterObjectType("GameObject", 0, asOBJ_REF | asOBJ_NOCOUNT);
 		m_scriptEngine->RegisterObjectType("Transform", 0, asOBJ_REF | asOBJ_NOCOUNT);
 		m_scriptEngine->RegisterObjectType("MeshRenderer", 0, asOBJ_REF | asOBJ_NOCOUNT);
@@ -155,6 +159,27 @@ namespace Directus
 		m_scriptEngine->RegisterObjectMethod("Time", "float GetDeltaTime()", asMETHOD(Timer, GetDeltaTimeSec), asCALL_THISCALL);
 	}
 
+	/*------------------------------------------------------------------------------
+										[SCENE]
+	------------------------------------------------------------------------------*/
+	// Returns null when nothing is hit between origin and end
+	static GameObject* SceneRaycast(const Vector3& origin, const Vector3& end, Scene* scene)
+	{
+		// The scene casts an infinite ray, hits past the end of the segment don't count
+		float hitDistance = 0.0f;
+		auto hit = scene->Raycast(Ray(origin, end), &hitDistance);
+		if (hit.expired() || hitDistance > Vector3::Length(origin, end))
+			return nullptr;
+
+		return hit._Get();
+	}
+
+	void ScriptInterface::RegisterScene()
+	{
+		m_scriptEngine->RegisterGlobalProperty("Scene scene", m_context->GetSubsystem<Scene>());
+		m_scriptEngine->RegisterObjectMethod("Scene", "GameObject @Raycast(const Vector3 &in, const Vector3 &in)", asFUNCTION(SceneRaycast), asCALL_CDECL_OBJLAST);
+	}
+
 	/*------------------------------------------------------------------------------
 										[GAMEOBJECT]
 	------------------------------------------------------------------------------*/
@@ -470,5 +495,6 @@ namespace Directus
 		m_scriptEngine->RegisterGlobalFunction("void Log(float, LogType)", asFUNCTIONPR(Log::Write, (float, Log::LogType), void), asCALL_CDECL);
 		m_scriptEngine->RegisterGlobalFunction("void Log(const Vector3& in, LogType)", asFUNCTIONPR(Log::Write, (const Vector3&, Log::LogType), void), asCALL_CDECL);
 		m_scriptEngine->RegisterGlobalFunction("void Log(const Quaternion& in, LogType)", asFUNCTIONPR(Log::Write, (const Quaternion&, Log::LogType), void), asCALL_CDECL);
+		m_scriptEngine->RegisterGlobalFunction("bool DumpMemoryReport(const string& in)", asFUNCTION(PerformanceProfiler::DumpMemoryReport), asCALL_CDECL);
 	}
 }
\ No newline at end of file
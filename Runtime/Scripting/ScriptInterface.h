@@ -38,6 +38,7 @@ namespace Directus
 		void RegisterSettings();
 		void RegisterInput();
 		void RegisterTime();
+		void RegisterScene();
 		void RegisterGameObject();
 		void RegisterTransform();
 		void RegisterMeshRenderer();
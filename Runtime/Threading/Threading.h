@@ -25,8 +25,11 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <vector>
 #include <thread>
 #include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <memory>
 #include <queue>
-#include "../Core/Subsystem.h"
+#include "../Core/SubSystem.h"
 //============================
 
 namespace Directus